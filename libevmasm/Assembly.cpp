@@ -43,10 +43,13 @@
 #include <range/v3/view/enumerate.hpp>
 #include <range/v3/view/map.hpp>
 
+#include <atomic>
 #include <fstream>
+#include <future>
 #include <limits>
 #include <iterator>
 #include <stack>
+#include <thread>
 
 using namespace solidity;
 using namespace solidity::evmasm;
@@ -772,6 +775,25 @@ AssemblyItem Assembly::newAuxDataLoadN(size_t _offset)
 	return AssemblyItem{AuxDataLoadN, _offset};
 }
 
+namespace
+{
+/// Number of threads currently optimising sub-assemblies in addition to the threads that started the optimisation.
+std::atomic<unsigned> subAssemblyThreads = 0;
+
+/// Reserves one more thread for optimising a sub-assembly.
+/// @returns false if @a _maxThreads threads, or all hardware threads if it is zero, are already in use.
+bool reserveSubAssemblyThread(size_t _maxThreads)
+{
+	size_t const hardwareThreads = std::thread::hardware_concurrency();
+	size_t const maxThreads = _maxThreads > 0 ? std::min(_maxThreads, std::max<size_t>(hardwareThreads, 1)) : hardwareThreads;
+	unsigned threads = subAssemblyThreads.load();
+	while (threads + 1 < maxThreads)
+		if (subAssemblyThreads.compare_exchange_weak(threads, threads + 1))
+			return true;
+	return false;
+}
+}
+
 Assembly& Assembly::optimise(OptimiserSettings const& _settings)
 {
 	optimiseInternal(_settings, {});
@@ -787,69 +809,130 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 		return *m_tagReplacements;
 
 	// Run optimisation for sub-assemblies.
+	// The optimisation of a sub-assembly only depends on the tags of it referenced from this assembly,
+	// so sub-assemblies can be optimised concurrently as long as they do not share any assembly
+	// that still needs to be optimised. The replacements are applied in order afterwards.
 	// TODO: verify and double-check this for EOF.
+	std::vector<std::set<size_t>> referencedTags(m_subs.size());
 	for (size_t subId = 0; subId < m_subs.size(); ++subId)
-	{
-		OptimiserSettings settings = _settings;
-		Assembly& sub = *m_subs[subId];
-		std::set<size_t> referencedTags;
 		for (auto& codeSection: m_codeSections)
-			referencedTags += JumpdestRemover::referencedTags(codeSection.items, subId);
-		std::map<u256, u256> const& subTagReplacements = sub.optimiseInternal(
-			settings,
-			referencedTags
-		);
-		// Apply the replacements (can be empty).
-		for (auto& codeSection: m_codeSections)
-			BlockDeduplicator::applyTagReplacement(codeSection.items, subTagReplacements, subId);
+			referencedTags[subId] += JumpdestRemover::referencedTags(codeSection.items, subId);
+
+	bool optimiseSubsConcurrently = m_subs.size() > 1 && _settings.maxThreads != 1;
+	if (optimiseSubsConcurrently)
+	{
+		std::set<Assembly const*> unoptimisedAssemblies;
+		for (auto const& sub: m_subs)
+		{
+			std::set<Assembly const*> subAssemblies;
+			sub->collectUnoptimisedAssemblies(subAssemblies);
+			for (Assembly const* assembly: subAssemblies)
+				if (!unoptimisedAssemblies.insert(assembly).second)
+					optimiseSubsConcurrently = false;
+		}
 	}
 
+	std::vector<std::map<u256, u256> const*> subTagReplacements(m_subs.size(), nullptr);
+	auto optimiseSub = [&](size_t _subId) {
+		subTagReplacements[_subId] = &m_subs[_subId]->optimiseInternal(_settings, referencedTags[_subId]);
+	};
+	{
+		std::vector<std::future<void>> concurrentOptimisations;
+		for (size_t subId = 0; subId < m_subs.size(); ++subId)
+			// The last sub-assembly is always optimised on the current thread.
+			if (optimiseSubsConcurrently && subId + 1 < m_subs.size() && reserveSubAssemblyThread(_settings.maxThreads))
+				concurrentOptimisations.emplace_back(std::async(std::launch::async, [&, subId]() {
+					ScopeGuard releaseThread([]() { --subAssemblyThreads; });
+					optimiseSub(subId);
+				}));
+			else
+				optimiseSub(subId);
+		for (auto& optimisation: concurrentOptimisations)
+			optimisation.get();
+	}
+
+	// Apply the replacements (can be empty).
+	for (size_t subId = 0; subId < m_subs.size(); ++subId)
+		for (auto& codeSection: m_codeSections)
+			BlockDeduplicator::applyTagReplacement(codeSection.items, *subTagReplacements[subId], subId);
+
 	std::map<u256, u256> tagReplacements;
+	// Each pass only depends on the code and on the tags referenced from outside, both of which
+	// only change when some pass reports a modification. A pass that left everything unchanged
+	// does not have to run again until the next modification; this in particular avoids re-running
+	// the passes that already reached their fixed point in the final, confirming iteration.
+	size_t modifications = 0;
+	std::optional<size_t> inlinerIdleAt;
+	std::optional<size_t> jumpdestRemoverIdleAt;
+	std::optional<size_t> peepholeIdleAt;
+	std::optional<size_t> deduplicatorIdleAt;
+	std::optional<size_t> cseIdleAt;
+	// Records the outcome of a pass: bumps the modification counter or marks the pass as idle.
+	auto finishPass = [&](std::optional<size_t>& _idleAt, bool _modified) {
+		if (_modified)
+			++modifications;
+		else
+			_idleAt = modifications;
+	};
+
 	// Iterate until no new optimisation possibilities are found.
 	for (unsigned count = 1; count > 0;)
 	{
 		count = 0;
 
 		// TODO: verify this for EOF.
-		if (_settings.runInliner && !m_eofVersion.has_value())
+		if (_settings.runInliner && !m_eofVersion.has_value() && inlinerIdleAt != modifications)
 		{
 			solAssert(m_codeSections.size() == 1);
-			Inliner{
+			finishPass(inlinerIdleAt, Inliner{
 				m_codeSections.front().items,
 				_tagsReferencedFromOutside,
 				_settings.expectedExecutionsPerDeployment,
 				isCreation(),
 				m_evmVersion
-			}.optimise();
+			}.optimise());
 		}
 		// TODO: verify this for EOF.
-		if (_settings.runJumpdestRemover && !m_eofVersion.has_value())
+		if (_settings.runJumpdestRemover && !m_eofVersion.has_value() && jumpdestRemoverIdleAt != modifications)
 		{
+			bool modified = false;
 			for (auto& codeSection: m_codeSections)
 			{
 				JumpdestRemover jumpdestOpt{codeSection.items};
 				if (jumpdestOpt.optimise(_tagsReferencedFromOutside))
+				{
 					count++;
+					modified = true;
+				}
 			}
+			finishPass(jumpdestRemoverIdleAt, modified);
 		}
 
 		// TODO: verify this for EOF.
-		if (_settings.runPeephole && !m_eofVersion.has_value())
+		if (_settings.runPeephole && !m_eofVersion.has_value() && peepholeIdleAt != modifications)
 		{
+			bool modified = false;
 			for (auto& codeSection: m_codeSections)
 			{
 				PeepholeOptimiser peepOpt{codeSection.items, m_evmVersion};
 				while (peepOpt.optimise())
 				{
 					count++;
+					modified = true;
 					assertThrow(count < 64000, OptimizerException, "Peephole optimizer seems to be stuck.");
 				}
 			}
+			if (modified)
+				++modifications;
+			// The loop above only stops once the peephole optimiser cannot find anything else to do.
+			peepholeIdleAt = modifications;
 		}
 
 		// This only modifies PushTags, we have to run again to actually remove code.
 		// TODO: implement for EOF.
-		if (_settings.runDeduplicate && !m_eofVersion.has_value())
+		if (_settings.runDeduplicate && !m_eofVersion.has_value() && deduplicatorIdleAt != modifications)
+		{
+			bool modified = false;
 			for (auto& section: m_codeSections)
 			{
 				BlockDeduplicator deduplicator{section.items};
@@ -872,11 +955,14 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 							_tagsReferencedFromOutside.insert(static_cast<size_t>(replacement.second));
 					}
 					count++;
+					modified = true;
 				}
 			}
+			finishPass(deduplicatorIdleAt, modified);
+		}
 
 		// TODO: investigate for EOF
-		if (_settings.runCSE && !m_eofVersion.has_value())
+		if (_settings.runCSE && !m_eofVersion.has_value() && cseIdleAt != modifications)
 		{
 			// Control flow graph optimization has been here before but is disabled because it
 			// assumes we only jump to tags that are pushed. This is not the case anymore with
@@ -922,11 +1008,13 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 				else
 					copy(orig, iter, back_inserter(optimisedItems));
 			}
-			if (optimisedItems.size() < items.size())
+			bool modified = optimisedItems.size() < items.size();
+			if (modified)
 			{
 				items = std::move(optimisedItems);
 				count++;
 			}
+			finishPass(cseIdleAt, modified);
 		}
 	}
 
@@ -943,6 +1031,14 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 	return *m_tagReplacements;
 }
 
+void Assembly::collectUnoptimisedAssemblies(std::set<Assembly const*>& _assemblies) const
+{
+	if (m_tagReplacements || !_assemblies.insert(this).second)
+		return;
+	for (auto const& sub: m_subs)
+		sub->collectUnoptimisedAssemblies(_assemblies);
+}
+
 namespace
 {
 template<typename ValueT>
@@ -1772,7 +1868,7 @@ Assembly const* Assembly::subAssemblyById(size_t _subId) const
 Assembly::OptimiserSettings Assembly::OptimiserSettings::translateSettings(frontend::OptimiserSettings const& _settings)
 {
 	// Constructing it this way so that we notice changes in the fields.
-	OptimiserSettings asmSettings{false,  false, false, false, false, false, 0};
+	OptimiserSettings asmSettings{false,  false, false, false, false, false, 0, 0};
 	asmSettings.runInliner = _settings.runInliner;
 	asmSettings.runJumpdestRemover = _settings.runJumpdestRemover;
 	asmSettings.runPeephole = _settings.runPeephole;
@@ -1780,5 +1876,6 @@ Assembly::OptimiserSettings Assembly::OptimiserSettings::translateSettings(front
 	asmSettings.runCSE = _settings.runCSE;
 	asmSettings.runConstantOptimiser = _settings.runConstantOptimiser;
 	asmSettings.expectedExecutionsPerDeployment = _settings.expectedExecutionsPerDeployment;
+	asmSettings.maxThreads = _settings.maxThreads;
 	return asmSettings;
 }
@@ -169,6 +169,10 @@ public:
 		/// This specifies an estimate on how often each opcode in this assembly will be executed,
 		/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 		size_t expectedExecutionsPerDeployment = frontend::OptimiserSettings{}.expectedExecutionsPerDeployment;
+		/// Maximum number of threads optimising sub-assemblies at the same time, including the calling thread.
+		/// Zero means one per hardware thread and 1 optimises all sub-assemblies on the calling thread.
+		/// The result does not depend on this setting.
+		size_t maxThreads = frontend::OptimiserSettings{}.maxThreads;
 
 		static OptimiserSettings translateSettings(frontend::OptimiserSettings const& _settings);
 	};
@@ -242,6 +246,9 @@ protected:
 	/// returns the replaced tags. Also takes an argument containing the tags of this assembly
 	/// that are referenced in a super-assembly.
 	std::map<u256, u256> const& optimiseInternal(OptimiserSettings const& _settings, std::set<size_t> _tagsReferencedFromOutside);
+	/// Adds this assembly and all its (transitive) sub-assemblies that have not been optimised yet
+	/// to @a _assemblies.
+	void collectUnoptimisedAssemblies(std::set<Assembly const*>& _assemblies) const;
 
 	/// For EOF and legacy it calculates approximate size of "pure" code without data.
 	unsigned codeSize(unsigned subTagSize) const;
@@ -27,16 +27,35 @@
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/SemanticInformation.h>
 
+#include <boost/container_hash/hash.hpp>
+
+#include <algorithm>
 #include <functional>
-#include <set>
+#include <unordered_map>
 
 using namespace solidity;
 using namespace solidity::evmasm;
 
+namespace
+{
+
+/// @returns a hash of @a _item that is compatible with AssemblyItem::operator==.
+size_t hashItem(AssemblyItem const& _item)
+{
+	size_t seed = 0;
+	boost::hash_combine(seed, _item.type());
+	if (_item.type() == Operation)
+		boost::hash_combine(seed, _item.instruction());
+	else if (_item.type() != VerbatimBytecode)
+		boost::hash_combine(seed, _item.data());
+	return seed;
+}
+
+}
 
 bool BlockDeduplicator::deduplicate()
 {
-	// Compares indices based on the suffix that starts there, ignoring tags and stopping at
+	// Compares blocks based on the suffix that starts at their tag, ignoring tags and stopping at
 	// opcodes that stop the control flow.
 
 	// Virtual tag that signifies "the current block" and which is used to optimise loops.
@@ -48,52 +67,90 @@ bool BlockDeduplicator::deduplicate()
 	)
 		return false;
 
-	std::function<bool(size_t, size_t)> comparator = [&](size_t _i, size_t _j)
+	using diff_type = BlockIterator::difference_type;
+	BlockIterator const end{m_items.end(), m_items.end()};
+
+	// To compare recursive loops, we have to already unify PushTag opcodes of the
+	// block's own tag. @a _pushOwnTag has to be the push of the tag at @a _i.
+	auto blockBegin = [&](size_t _i, AssemblyItem const& _pushOwnTag)
 	{
-		if (_i == _j)
-			return false;
-
-		// To compare recursive loops, we have to already unify PushTag opcodes of the
-		// block's own tag.
-		AssemblyItem pushFirstTag{pushSelf};
-		AssemblyItem pushSecondTag{pushSelf};
-
-		if (_i < m_items.size() && m_items.at(_i).type() == Tag)
-			pushFirstTag = m_items.at(_i).pushTag();
-		if (_j < m_items.size() && m_items.at(_j).type() == Tag)
-			pushSecondTag = m_items.at(_j).pushTag();
-
-		using diff_type = BlockIterator::difference_type;
-		BlockIterator first{m_items.begin() + diff_type(_i), m_items.end(), &pushFirstTag, &pushSelf};
-		BlockIterator second{m_items.begin() + diff_type(_j), m_items.end(), &pushSecondTag, &pushSelf};
-		BlockIterator end{m_items.end(), m_items.end()};
-
-		if (first != end && (*first).type() == Tag)
-			++first;
-		if (second != end && (*second).type() == Tag)
-			++second;
-
-		return std::lexicographical_compare(first, end, second, end);
+		BlockIterator it{m_items.begin() + diff_type(_i), m_items.end(), &_pushOwnTag, &pushSelf};
+		if (it != end && (*it).type() == Tag)
+			++it;
+		return it;
+	};
+
+	auto equalBlocks = [&](size_t _i, size_t _j)
+	{
+		AssemblyItem pushFirstTag = m_items.at(_i).pushTag();
+		AssemblyItem pushSecondTag = m_items.at(_j).pushTag();
+		return std::equal(blockBegin(_i, pushFirstTag), end, blockBegin(_j, pushSecondTag), end);
 	};
 
+	// Structural hash of each block and the position after its last item, indexed by the
+	// position of the block's tag. Blocks are only compared item by item if their hashes match.
+	std::vector<size_t> tagPositions;
+	std::vector<size_t> blockHashes(m_items.size());
+	std::vector<size_t> blockEnds(m_items.size());
+	auto hashBlock = [&](size_t _i)
+	{
+		AssemblyItem pushOwnTag = m_items.at(_i).pushTag();
+		size_t hash = 0;
+		size_t blockEnd = _i + 1;
+		for (BlockIterator it = blockBegin(_i, pushOwnTag); it != end; ++it)
+		{
+			boost::hash_combine(hash, hashItem(*it));
+			blockEnd = static_cast<size_t>(it.it - m_items.begin()) + 1;
+		}
+		blockHashes[_i] = hash;
+		blockEnds[_i] = blockEnd;
+	};
+
+	for (size_t i = 0; i < m_items.size(); ++i)
+		if (m_items.at(i).type() == Tag)
+		{
+			tagPositions.push_back(i);
+			hashBlock(i);
+		}
+
 	size_t iterations = 0;
 	for (; ; ++iterations)
 	{
-		//@todo this should probably be optimized.
-		std::set<size_t, std::function<bool(size_t, size_t)>> blocksSeen(comparator);
-		for (size_t i = 0; i < m_items.size(); ++i)
+		// Maps block hashes to the first block of each class of equal blocks with that hash.
+		std::unordered_map<size_t, std::vector<size_t>> blocksSeen;
+		for (size_t i: tagPositions)
 		{
-			if (m_items.at(i).type() != Tag)
-				continue;
-			auto it = blocksSeen.find(i);
-			if (it == blocksSeen.end())
-				blocksSeen.insert(i);
+			std::vector<size_t>& candidates = blocksSeen[blockHashes[i]];
+			auto it = std::find_if(candidates.begin(), candidates.end(), [&](size_t _j) { return equalBlocks(_j, i); });
+			if (it == candidates.end())
+				candidates.push_back(i);
 			else
 				m_replacedTags[m_items.at(i).data()] = m_items.at(*it).data();
 		}
 
+		// Positions of the items that applyTagReplacement is about to change.
+		std::vector<size_t> changedPositions;
+		for (size_t i = 0; i < m_items.size(); ++i)
+		{
+			AssemblyItem const& item = m_items.at(i);
+			if (item.type() == PushTag || item.type() == RelativeJump || item.type() == ConditionalRelativeJump)
+			{
+				auto [subId, tagId] = item.splitForeignPushTag();
+				if (subId == size_t(-1) && m_replacedTags.count(tagId))
+					changedPositions.push_back(i);
+			}
+		}
+
 		if (!applyTagReplacement(m_items, m_replacedTags))
 			break;
+
+		// Only blocks containing replaced tags need to be rehashed.
+		for (size_t i: tagPositions)
+		{
+			auto changed = std::lower_bound(changedPositions.begin(), changedPositions.end(), i);
+			if (changed != changedPositions.end() && *changed < blockEnds[i])
+				hashBlock(i);
+		}
 	}
 	return iterations > 0;
 }
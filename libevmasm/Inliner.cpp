@@ -235,13 +235,14 @@ std::optional<AssemblyItem> Inliner::shouldInline(size_t _tag, AssemblyItem cons
 }
 
 
-void Inliner::optimise()
+bool Inliner::optimise()
 {
 	std::map<size_t, InlinableBlock> inlinableBlocks = determineInlinableBlocks(m_items);
 
 	if (inlinableBlocks.empty())
-		return;
+		return false;
 
+	bool inlined = false;
 	AssemblyItems newItems;
 	for (auto it = m_items.begin(); it != m_items.end(); ++it)
 	{
@@ -267,6 +268,7 @@ void Inliner::optimise()
 										if (auto* block = util::valueOrNullptr(inlinableBlocks, *duplicatedTag))
 											++block->pushTagCount;
 
+							inlined = true;
 							// Skip the original jump to the inlined tag and continue.
 							++it;
 							continue;
@@ -276,5 +278,9 @@ void Inliner::optimise()
 		newItems.emplace_back(item);
 	}
 
+	if (!inlined)
+		return false;
+
 	m_items = std::move(newItems);
+	return true;
 }
@@ -26,6 +26,7 @@
 #include <libevmasm/AssemblyItem.h>
 #include <libsolutil/Keccak256.h>
 
+#include <algorithm>
 #include <functional>
 #include <utility>
 
@@ -60,13 +61,13 @@ std::ostream& KnownState::stream(std::ostream& _out) const
 		streamExpressionClass(_out, eqClass);
 
 	_out << "Stack:" << std::endl;
-	for (auto const& it: m_stackElements)
+	for (auto const& it: *m_stackElements)
 	{
 		_out << "  " << std::dec << it.first << ": ";
 		streamExpressionClass(_out, it.second);
 	}
 	_out << "Storage:" << std::endl;
-	for (auto const& it: m_storageContent)
+	for (auto const& it: *m_storageContent)
 	{
 		_out << "  ";
 		streamExpressionClass(_out, it.first);
@@ -74,7 +75,7 @@ std::ostream& KnownState::stream(std::ostream& _out) const
 		streamExpressionClass(_out, it.second);
 	}
 	_out << "Memory:" << std::endl;
-	for (auto const& it: m_memoryContent)
+	for (auto const& it: *m_memoryContent)
 	{
 		_out << "  ";
 		streamExpressionClass(_out, it.first);
@@ -107,10 +108,7 @@ KnownState::StoreOperation KnownState::feedItem(AssemblyItem const& _item, bool
 		resetKnownKeccak256Hashes();
 		resetStorage();
 		// Consume all arguments and place unknown return values on the stack.
-		m_stackElements.erase(
-			m_stackElements.upper_bound(m_stackHeight - static_cast<int>(_item.arguments())),
-			m_stackElements.end()
-		);
+		eraseStackElementsAbove(m_stackHeight - static_cast<int>(_item.arguments()));
 		m_stackHeight += static_cast<int>(_item.deposit());
 		for (size_t i = 0; i < _item.returnValues(); ++i)
 			setStackElement(
@@ -202,10 +200,7 @@ KnownState::StoreOperation KnownState::feedItem(AssemblyItem const& _item, bool
 					);
 			}
 		}
-		m_stackElements.erase(
-			m_stackElements.upper_bound(m_stackHeight + static_cast<int>(_item.deposit())),
-			m_stackElements.end()
-		);
+		eraseStackElementsAbove(m_stackHeight + static_cast<int>(_item.deposit()));
 		m_stackHeight += static_cast<int>(_item.deposit());
 	}
 	return op;
@@ -213,22 +208,29 @@ KnownState::StoreOperation KnownState::feedItem(AssemblyItem const& _item, bool
 
 /// Helper function for KnownState::reduceToCommonKnowledge, removes everything from
 /// _this which is not in or not equal to the value in _other.
-template <class Mapping> void intersect(Mapping& _this, Mapping const& _other)
+template <class Mapping> void intersect(util::CopyOnWrite<Mapping>& _this, util::CopyOnWrite<Mapping> const& _other)
 {
-	for (auto it = _this.begin(); it != _this.end();)
-		if (_other.count(it->first) && _other.at(it->first) == it->second)
-			++it;
+	auto differs = [&](auto const& _entry) {
+		return !_other->count(_entry.first) || _other->at(_entry.first) != _entry.second;
+	};
+	if (std::none_of(_this->begin(), _this->end(), differs))
+		return;
+	Mapping& mapping = _this.mutate();
+	for (auto it = mapping.begin(); it != mapping.end();)
+		if (differs(*it))
+			it = mapping.erase(it);
 		else
-			it = _this.erase(it);
+			++it;
 }
 
 void KnownState::reduceToCommonKnowledge(KnownState const& _other, bool _combineSequenceNumbers)
 {
 	int stackDiff = m_stackHeight - _other.m_stackHeight;
-	for (auto it = m_stackElements.begin(); it != m_stackElements.end();)
-		if (_other.m_stackElements.count(it->first - stackDiff))
+	std::map<int, Id>& stackElements = m_stackElements.mutate();
+	for (auto it = stackElements.begin(); it != stackElements.end();)
+		if (_other.m_stackElements->count(it->first - stackDiff))
 		{
-			Id other = _other.m_stackElements.at(it->first - stackDiff);
+			Id other = _other.m_stackElements->at(it->first - stackDiff);
 			if (it->second == other)
 				++it;
 			else
@@ -242,19 +244,19 @@ void KnownState::reduceToCommonKnowledge(KnownState const& _other, bool _combine
 					++it;
 				}
 				else
-					it = m_stackElements.erase(it);
+					it = stackElements.erase(it);
 			}
 		}
 		else
-			it = m_stackElements.erase(it);
+			it = stackElements.erase(it);
 
 	// Use the smaller stack height. Essential to terminate in case of loops.
 	if (m_stackHeight > _other.m_stackHeight)
 	{
 		std::map<int, Id> shiftedStack;
-		for (auto const& stackElement: m_stackElements)
+		for (auto const& stackElement: stackElements)
 			shiftedStack[stackElement.first - stackDiff] = stackElement.second;
-		m_stackElements = std::move(shiftedStack);
+		stackElements = std::move(shiftedStack);
 		m_stackHeight = _other.m_stackHeight;
 	}
 
@@ -266,23 +268,23 @@ void KnownState::reduceToCommonKnowledge(KnownState const& _other, bool _combine
 
 bool KnownState::operator==(KnownState const& _other) const
 {
-	if (m_storageContent != _other.m_storageContent || m_memoryContent != _other.m_memoryContent)
+	if (*m_storageContent != *_other.m_storageContent || *m_memoryContent != *_other.m_memoryContent)
 		return false;
 	int stackDiff = m_stackHeight - _other.m_stackHeight;
-	auto thisIt = m_stackElements.cbegin();
-	auto otherIt = _other.m_stackElements.cbegin();
-	for (; thisIt != m_stackElements.cend() && otherIt != _other.m_stackElements.cend(); ++thisIt, ++otherIt)
+	auto thisIt = m_stackElements->cbegin();
+	auto otherIt = _other.m_stackElements->cbegin();
+	for (; thisIt != m_stackElements->cend() && otherIt != _other.m_stackElements->cend(); ++thisIt, ++otherIt)
 		if (thisIt->first - stackDiff != otherIt->first || thisIt->second != otherIt->second)
 			return false;
-	return (thisIt == m_stackElements.cend() && otherIt == _other.m_stackElements.cend());
+	return (thisIt == m_stackElements->cend() && otherIt == _other.m_stackElements->cend());
 }
 
 ExpressionClasses::Id KnownState::stackElement(int _stackHeight, langutil::DebugData::ConstPtr _debugData)
 {
-	if (m_stackElements.count(_stackHeight))
-		return m_stackElements.at(_stackHeight);
+	if (auto it = m_stackElements->find(_stackHeight); it != m_stackElements->end())
+		return it->second;
 	// Stack element not found (not assigned yet), create new unknown equivalence class.
-	return m_stackElements[_stackHeight] =
+	return m_stackElements.mutate()[_stackHeight] =
 			m_expressionClasses->find(AssemblyItem(UndefinedItem, _stackHeight, std::move(_debugData)));
 }
 
@@ -293,16 +295,27 @@ KnownState::Id KnownState::relativeStackElement(int _stackOffset, langutil::Debu
 
 void KnownState::clearTagUnions()
 {
-	for (auto it = m_stackElements.begin(); it != m_stackElements.end();)
-		if (m_tagUnions.left.count(it->second))
-			it = m_stackElements.erase(it);
+	if (m_tagUnions->empty())
+		return;
+	std::map<int, Id>& stackElements = m_stackElements.mutate();
+	for (auto it = stackElements.begin(); it != stackElements.end();)
+		if (m_tagUnions->left.count(it->second))
+			it = stackElements.erase(it);
 		else
 			++it;
 }
 
 void KnownState::setStackElement(int _stackHeight, Id _class)
 {
-	m_stackElements[_stackHeight] = _class;
+	m_stackElements.mutate()[_stackHeight] = _class;
+}
+
+void KnownState::eraseStackElementsAbove(int _stackHeight)
+{
+	if (m_stackElements->upper_bound(_stackHeight) == m_stackElements->end())
+		return;
+	std::map<int, Id>& stackElements = m_stackElements.mutate();
+	stackElements.erase(stackElements.upper_bound(_stackHeight), stackElements.end());
 }
 
 void KnownState::swapStackElements(
@@ -316,7 +329,8 @@ void KnownState::swapStackElements(
 	stackElement(_stackHeightA, _debugData);
 	stackElement(_stackHeightB, _debugData);
 
-	std::swap(m_stackElements[_stackHeightA], m_stackElements[_stackHeightB]);
+	std::map<int, Id>& stackElements = m_stackElements.mutate();
+	std::swap(stackElements[_stackHeightA], stackElements[_stackHeightB]);
 }
 
 KnownState::StoreOperation KnownState::storeInStorage(
@@ -325,23 +339,23 @@ KnownState::StoreOperation KnownState::storeInStorage(
 	langutil::DebugData::ConstPtr _debugData
 )
 {
-	if (m_storageContent.count(_slot) && m_storageContent[_slot] == _value)
+	if (auto it = m_storageContent->find(_slot); it != m_storageContent->end() && it->second == _value)
 		// do not execute the storage if we know that the value is already there
 		return StoreOperation();
 	m_sequenceNumber++;
-	decltype(m_storageContent) storageContents;
+	std::map<Id, Id> storageContents;
 	// Copy over all values (i.e. retain knowledge about them) where we know that this store
 	// operation will not destroy the knowledge. Specifically, we copy storage locations we know
 	// are different from _slot or locations where we know that the stored value is equal to _value.
-	for (auto const& storageItem: m_storageContent)
+	for (auto const& storageItem: *m_storageContent)
 		if (m_expressionClasses->knownToBeDifferent(storageItem.first, _slot) || storageItem.second == _value)
 			storageContents.insert(storageItem);
-	m_storageContent = std::move(storageContents);
 
 	AssemblyItem item(Instruction::SSTORE, std::move(_debugData));
 	Id id = m_expressionClasses->find(item, {_slot, _value}, true, m_sequenceNumber);
 	StoreOperation operation{StoreOperation::Storage, _slot, m_sequenceNumber, id};
-	m_storageContent[_slot] = _value;
+	storageContents[_slot] = _value;
+	m_storageContent = util::CopyOnWrite<std::map<Id, Id>>{std::move(storageContents)};
 	// increment a second time so that we get unique sequence numbers for writes
 	m_sequenceNumber++;
 
@@ -350,30 +364,30 @@ KnownState::StoreOperation KnownState::storeInStorage(
 
 ExpressionClasses::Id KnownState::loadFromStorage(Id _slot, langutil::DebugData::ConstPtr _debugData)
 {
-	if (m_storageContent.count(_slot))
-		return m_storageContent.at(_slot);
+	if (auto it = m_storageContent->find(_slot); it != m_storageContent->end())
+		return it->second;
 
 	AssemblyItem item(Instruction::SLOAD, std::move(_debugData));
-	return m_storageContent[_slot] = m_expressionClasses->find(item, {_slot}, true, m_sequenceNumber);
+	return m_storageContent.mutate()[_slot] = m_expressionClasses->find(item, {_slot}, true, m_sequenceNumber);
 }
 
 KnownState::StoreOperation KnownState::storeInMemory(Id _slot, Id _value, langutil::DebugData::ConstPtr _debugData)
 {
-	if (m_memoryContent.count(_slot) && m_memoryContent[_slot] == _value)
+	if (auto it = m_memoryContent->find(_slot); it != m_memoryContent->end() && it->second == _value)
 		// do not execute the store if we know that the value is already there
 		return StoreOperation();
 	m_sequenceNumber++;
-	decltype(m_memoryContent) memoryContents;
+	std::map<Id, Id> memoryContents;
 	// copy over values at points where we know that they are different from _slot by at least 32
-	for (auto const& memoryItem: m_memoryContent)
+	for (auto const& memoryItem: *m_memoryContent)
 		if (m_expressionClasses->knownToBeDifferentBy32(memoryItem.first, _slot))
 			memoryContents.insert(memoryItem);
-	m_memoryContent = std::move(memoryContents);
 
 	AssemblyItem item(Instruction::MSTORE, std::move(_debugData));
 	Id id = m_expressionClasses->find(item, {_slot, _value}, true, m_sequenceNumber);
 	StoreOperation operation{StoreOperation::Memory, _slot, m_sequenceNumber, id};
-	m_memoryContent[_slot] = _value;
+	memoryContents[_slot] = _value;
+	m_memoryContent = util::CopyOnWrite<std::map<Id, Id>>{std::move(memoryContents)};
 	// increment a second time so that we get unique sequence numbers for writes
 	m_sequenceNumber++;
 	return operation;
@@ -381,11 +395,11 @@ KnownState::StoreOperation KnownState::storeInMemory(Id _slot, Id _value, langut
 
 ExpressionClasses::Id KnownState::loadFromMemory(Id _slot, langutil::DebugData::ConstPtr _debugData)
 {
-	if (m_memoryContent.count(_slot))
-		return m_memoryContent.at(_slot);
+	if (auto it = m_memoryContent->find(_slot); it != m_memoryContent->end())
+		return it->second;
 
 	AssemblyItem item(Instruction::MLOAD, std::move(_debugData));
-	return m_memoryContent[_slot] = m_expressionClasses->find(item, {_slot}, true, m_sequenceNumber);
+	return m_memoryContent.mutate()[_slot] = m_expressionClasses->find(item, {_slot}, true, m_sequenceNumber);
 }
 
 KnownState::Id KnownState::applyKeccak256(
@@ -410,8 +424,8 @@ KnownState::Id KnownState::applyKeccak256(
 		);
 		arguments.push_back(loadFromMemory(slot, _debugData));
 	}
-	if (m_knownKeccak256Hashes.count({arguments, length}))
-		return m_knownKeccak256Hashes.at({arguments, length});
+	if (auto it = m_knownKeccak256Hashes->find({arguments, length}); it != m_knownKeccak256Hashes->end())
+		return it->second;
 	Id v;
 	// If all arguments are known constants, compute the Keccak-256 here
 	if (all_of(arguments.begin(), arguments.end(), [this](Id _a) { return !!m_expressionClasses->knownConstant(_a); }))
@@ -424,13 +438,13 @@ KnownState::Id KnownState::applyKeccak256(
 	}
 	else
 		v = m_expressionClasses->find(keccak256Item, {_start, _length}, true, m_sequenceNumber);
-	return m_knownKeccak256Hashes[{arguments, length}] = v;
+	return m_knownKeccak256Hashes.mutate()[{arguments, length}] = v;
 }
 
 std::set<u256> KnownState::tagsInExpression(KnownState::Id _expressionId)
 {
-	if (m_tagUnions.left.count(_expressionId))
-		return m_tagUnions.left.at(_expressionId);
+	if (m_tagUnions->left.count(_expressionId))
+		return m_tagUnions->left.at(_expressionId);
 	// Might be a tag, then return the set of itself.
 	ExpressionClasses::Expression expr = m_expressionClasses->representative(_expressionId);
 	if (expr.item && expr.item->type() == PushTag)
@@ -441,12 +455,12 @@ std::set<u256> KnownState::tagsInExpression(KnownState::Id _expressionId)
 
 KnownState::Id KnownState::tagUnion(std::set<u256> _tags)
 {
-	if (m_tagUnions.right.count(_tags))
-		return m_tagUnions.right.at(_tags);
+	if (m_tagUnions->right.count(_tags))
+		return m_tagUnions->right.at(_tags);
 	else
 	{
 		Id id = m_expressionClasses->newClass(langutil::DebugData::create());
-		m_tagUnions.right.insert(make_pair(_tags, id));
+		m_tagUnions.mutate().right.insert(make_pair(_tags, id));
 		return id;
 	}
 }
@@ -46,6 +46,7 @@
 #endif // defined(__clang__)
 
 #include <libsolutil/CommonIO.h>
+#include <libsolutil/CopyOnWrite.h>
 #include <libsolutil/Exceptions.h>
 #include <libevmasm/ExpressionClasses.h>
 #include <libevmasm/SemanticInformation.h>
@@ -108,13 +109,13 @@ public:
 	StoreOperation feedItem(AssemblyItem const& _item, bool _copyItem = false);
 
 	/// Resets any knowledge about storage.
-	void resetStorage() { m_storageContent.clear(); }
+	void resetStorage() { m_storageContent.reset(); }
 	/// Resets any knowledge about memory.
-	void resetMemory() { m_memoryContent.clear(); }
+	void resetMemory() { m_memoryContent.reset(); }
 	/// Resets known Keccak-256 hashes
-	void resetKnownKeccak256Hashes() { m_knownKeccak256Hashes.clear(); }
+	void resetKnownKeccak256Hashes() { m_knownKeccak256Hashes.reset(); }
 	/// Resets any knowledge about the current stack.
-	void resetStack() { m_stackElements.clear(); m_stackHeight = 0; }
+	void resetStack() { m_stackElements.reset(); m_stackHeight = 0; }
 	/// Resets any knowledge.
 	void reset() { resetStorage(); resetMemory(); resetKnownKeccak256Hashes(); resetStack(); }
 
@@ -127,6 +128,7 @@ public:
 	void reduceToCommonKnowledge(KnownState const& _other, bool _combineSequenceNumbers);
 
 	/// @returns a shared pointer to a copy of this state.
+	/// The knowledge is shared with this state until either of them modifies it.
 	std::shared_ptr<KnownState> copy() const { return std::make_shared<KnownState>(*this); }
 
 	/// @returns true if the knowledge about the state of both objects is (known to be) equal.
@@ -146,14 +148,16 @@ public:
 	void clearTagUnions();
 
 	int stackHeight() const { return m_stackHeight; }
-	std::map<int, Id> const& stackElements() const { return m_stackElements; }
+	std::map<int, Id> const& stackElements() const { return *m_stackElements; }
 	ExpressionClasses& expressionClasses() const { return *m_expressionClasses; }
 
-	std::map<Id, Id> const& storageContent() const { return m_storageContent; }
+	std::map<Id, Id> const& storageContent() const { return *m_storageContent; }
 
 private:
 	/// Assigns a new equivalence class to the next sequence number of the given stack element.
 	void setStackElement(int _stackHeight, Id _class);
+	/// Removes all knowledge about stack elements above the given stack height.
+	void eraseStackElementsAbove(int _stackHeight);
 	/// Swaps the given stack elements in their next sequence number.
 	void swapStackElements(int _stackHeightA, int _stackHeightB, langutil::DebugData::ConstPtr _debugData);
 
@@ -178,22 +182,22 @@ private:
 	/// Current stack height, can be negative.
 	int m_stackHeight = 0;
 	/// Current stack layout, mapping stack height -> equivalence class
-	std::map<int, Id> m_stackElements;
+	util::CopyOnWrite<std::map<int, Id>> m_stackElements;
 	/// Current sequence number, this is incremented with each modification to storage or memory.
 	unsigned m_sequenceNumber = 1;
 	/// Knowledge about storage content.
-	std::map<Id, Id> m_storageContent;
+	util::CopyOnWrite<std::map<Id, Id>> m_storageContent;
 	/// Knowledge about memory content. Keys are memory addresses, note that the values overlap
 	/// and are not contained here if they are not completely known.
-	std::map<Id, Id> m_memoryContent;
+	util::CopyOnWrite<std::map<Id, Id>> m_memoryContent;
 	/// Keeps record of all Keccak-256 hashes that are computed. The first parameter in the
 	/// std::pair corresponds to memory content and the second parameter corresponds to the length
 	/// that is accessed.
-	std::map<std::pair<std::vector<Id>, unsigned>, Id> m_knownKeccak256Hashes;
+	util::CopyOnWrite<std::map<std::pair<std::vector<Id>, unsigned>, Id>> m_knownKeccak256Hashes;
 	/// Structure containing the classes of equivalent expressions.
 	std::shared_ptr<ExpressionClasses> m_expressionClasses;
 	/// Container for unions of tags stored on the stack.
-	boost::bimap<Id, std::set<u256>> m_tagUnions;
+	util::CopyOnWrite<boost::bimap<Id, std::set<u256>>> m_tagUnions;
 };
 
 }
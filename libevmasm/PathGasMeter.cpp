@@ -30,9 +30,14 @@ using namespace solidity::evmasm;
 PathGasMeter::PathGasMeter(AssemblyItems const& _items, langutil::EVMVersion _evmVersion):
 	m_items(_items), m_evmVersion(_evmVersion)
 {
+	m_jumpdestNumbers.resize(m_items.size());
 	for (size_t i = 0; i < m_items.size(); ++i)
+	{
 		if (m_items[i].type() == Tag)
 			m_tagPositions[m_items[i].data()] = i;
+		if (m_items[i].type() == Tag || m_items[i] == AssemblyItem(Instruction::JUMPDEST))
+			m_jumpdestNumbers[i] = m_jumpdestCount++;
+	}
 }
 
 GasMeter::GasConsumption PathGasMeter::estimateMax(
@@ -40,9 +45,13 @@ GasMeter::GasConsumption PathGasMeter::estimateMax(
 	std::shared_ptr<KnownState> const& _state
 )
 {
+	m_queue.clear();
+	m_highestGasUsagePerJumpdest.clear();
+
 	auto path = std::make_unique<GasPath>();
 	path->index = _startIndex;
 	path->state = _state->copy();
+	path->visitedJumpdests.resize(m_jumpdestCount);
 	queue(std::move(path));
 
 	GasMeter::GasConsumption gas;
@@ -91,9 +100,9 @@ GasMeter::GasConsumption PathGasMeter::handleQueueItem()
 		{
 			// Do not allow any backwards jump. This is quite restrictive but should work for
 			// the simplest things.
-			if (path->visitedJumpdests.count(index))
+			if (path->visitedJumpdests[m_jumpdestNumbers[index]])
 				return GasMeter::GasConsumption::infinite();
-			path->visitedJumpdests.insert(index);
+			path->visitedJumpdests[m_jumpdestNumbers[index]] = true;
 		}
 		else if (item == AssemblyItem(Instruction::JUMP))
 		{
@@ -26,7 +26,7 @@
 
 #include <liblangutil/EVMVersion.h>
 
-#include <set>
+#include <map>
 #include <vector>
 #include <memory>
 
@@ -41,7 +41,8 @@ struct GasPath
 	std::shared_ptr<KnownState> state;
 	u256 largestMemoryAccess;
 	GasMeter::GasConsumption gas;
-	std::set<size_t> visitedJumpdests;
+	/// Jump destinations visited along this path, indexed by their number in PathGasMeter.
+	std::vector<bool> visitedJumpdests;
 };
 
 /**
@@ -54,6 +55,8 @@ class PathGasMeter
 public:
 	explicit PathGasMeter(AssemblyItems const& _items, langutil::EVMVersion _evmVersion);
 
+	/// Estimates the gas usage starting at @a _startIndex in state @a _state.
+	/// Can be called repeatedly, which avoids re-analysing the items for every estimate.
 	GasMeter::GasConsumption estimateMax(size_t _startIndex, std::shared_ptr<KnownState> const& _state);
 
 	static GasMeter::GasConsumption estimateMax(
@@ -79,6 +82,9 @@ private:
 	std::map<size_t, std::unique_ptr<GasPath>> m_queue;
 	std::map<size_t, GasMeter::GasConsumption> m_highestGasUsagePerJumpdest;
 	std::map<u256, size_t> m_tagPositions;
+	/// Number of each jump destination in m_items, used as index into GasPath::visitedJumpdests.
+	std::vector<size_t> m_jumpdestNumbers;
+	size_t m_jumpdestCount = 0;
 	AssemblyItems const& m_items;
 	langutil::EVMVersion m_evmVersion;
 };
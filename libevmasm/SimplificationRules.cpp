@@ -36,12 +36,25 @@ using namespace solidity;
 using namespace solidity::evmasm;
 using namespace solidity::langutil;
 
+namespace
+{
+
+/// Expressions matched by the patterns of the shared rule list, stored per thread so that
+/// the rules themselves can be used concurrently.
+std::map<unsigned, ExpressionClasses::Expression const*>& threadMatchGroups()
+{
+	static thread_local std::map<unsigned, ExpressionClasses::Expression const*> matchGroups;
+	return matchGroups;
+}
+
+}
+
 SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	Expression const& _expr,
 	ExpressionClasses const& _classes
-)
+) const
 {
-	resetMatchGroups();
+	threadMatchGroups().clear();
 
 	assertThrow(_expr.item, OptimizerException, "");
 	for (auto const& rule: m_rules[uint8_t(_expr.item->instruction())])
@@ -50,7 +63,7 @@ SimplificationRule<Pattern> const* Rules::findFirstMatch(
 			if (!rule.feasible || rule.feasible())
 				return &rule;
 
-		resetMatchGroups();
+		threadMatchGroups().clear();
 	}
 	return nullptr;
 }
@@ -83,13 +96,13 @@ Rules::Rules()
 	Pattern X;
 	Pattern Y;
 	Pattern Z;
-	A.setMatchGroup(1, m_matchGroups);
-	B.setMatchGroup(2, m_matchGroups);
-	C.setMatchGroup(3, m_matchGroups);
-	W.setMatchGroup(4, m_matchGroups);
-	X.setMatchGroup(5, m_matchGroups);
-	Y.setMatchGroup(6, m_matchGroups);
-	Z.setMatchGroup(7, m_matchGroups);
+	A.setMatchGroup(1);
+	B.setMatchGroup(2);
+	C.setMatchGroup(3);
+	W.setMatchGroup(4);
+	X.setMatchGroup(5);
+	Y.setMatchGroup(6);
+	Z.setMatchGroup(7);
 
 	addRules(simplificationRuleList(std::nullopt, A, B, C, W, X, Y, Z));
 	assertThrow(isInitialized(), OptimizerException, "Rule list not properly initialized.");
@@ -108,15 +121,22 @@ void Pattern::setMatchGroup(unsigned _group, std::map<unsigned, Expression const
 	m_matchGroups = &_matchGroups;
 }
 
+void Pattern::setMatchGroup(unsigned _group)
+{
+	m_matchGroup = _group;
+	m_matchGroups = nullptr;
+}
+
 bool Pattern::matches(Expression const& _expr, ExpressionClasses const& _classes) const
 {
 	if (!matchesBaseItem(_expr.item))
 		return false;
 	if (m_matchGroup)
 	{
-		if (!m_matchGroups->count(m_matchGroup))
-			(*m_matchGroups)[m_matchGroup] = &_expr;
-		else if ((*m_matchGroups)[m_matchGroup]->id != _expr.id)
+		auto& groups = matchGroups();
+		if (!groups.count(m_matchGroup))
+			groups[m_matchGroup] = &_expr;
+		else if (groups[m_matchGroup]->id != _expr.id)
 			return false;
 	}
 	assertThrow(m_arguments.size() == 0 || _expr.arguments.size() == m_arguments.size(), OptimizerException, "");
@@ -188,9 +208,14 @@ bool Pattern::matchesBaseItem(AssemblyItem const* _item) const
 Pattern::Expression const& Pattern::matchGroupValue() const
 {
 	assertThrow(m_matchGroup > 0, OptimizerException, "");
-	assertThrow(!!m_matchGroups, OptimizerException, "");
-	assertThrow((*m_matchGroups)[m_matchGroup], OptimizerException, "");
-	return *(*m_matchGroups)[m_matchGroup];
+	auto& groups = matchGroups();
+	assertThrow(groups[m_matchGroup], OptimizerException, "");
+	return *groups[m_matchGroup];
+}
+
+std::map<unsigned, Pattern::Expression const*>& Pattern::matchGroups() const
+{
+	return m_matchGroups ? *m_matchGroups : threadMatchGroups();
 }
 
 u256 const& Pattern::data() const
@@ -57,11 +57,11 @@ public:
 	Rules();
 
 	/// @returns a pointer to the first matching pattern and sets the match
-	/// groups accordingly.
+	/// groups of the current thread accordingly.
 	SimplificationRule<Pattern> const* findFirstMatch(
 		Expression const& _expr,
 		ExpressionClasses const& _classes
-	);
+	) const;
 
 	/// Checks whether the rulelist is non-empty. This is usually enforced
 	/// by the constructor, but we had some issues with static initialization.
@@ -71,9 +71,6 @@ private:
 	void addRules(std::vector<SimplificationRule<Pattern>> const& _rules);
 	void addRule(SimplificationRule<Pattern> const& _rule);
 
-	void resetMatchGroups() { m_matchGroups.clear(); }
-
-	std::map<unsigned, Expression const*> m_matchGroups;
 	/// Pattern to match, replacement to be applied and flag indicating whether
 	/// the replacement might remove some elements (except constants).
 	std::vector<SimplificationRule<Pattern>> m_rules[256];
@@ -108,6 +105,9 @@ public:
 	/// Inside one rule, all patterns in the same match group have to match expressions from the
 	/// same expression equivalence class.
 	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups);
+	/// Sets this pattern to be part of the match group with the identifier @a _group, storing
+	/// the matched expressions separately for every thread.
+	void setMatchGroup(unsigned _group);
 	unsigned matchGroup() const { return m_matchGroup; }
 	bool matches(Expression const& _expr, ExpressionClasses const& _classes) const;
 
@@ -131,6 +131,7 @@ public:
 private:
 	bool matchesBaseItem(AssemblyItem const* _item) const;
 	Expression const& matchGroupValue() const;
+	std::map<unsigned, Expression const*>& matchGroups() const;
 	u256 const& data() const;
 
 	AssemblyItemType m_type;
@@ -139,6 +140,7 @@ private:
 	std::shared_ptr<u256> m_data; ///< Only valid if m_type is not Operation
 	std::vector<Pattern> m_arguments;
 	unsigned m_matchGroup = 0;
+	/// Match groups of the pattern, or the ones of the current thread if not set.
 	std::map<unsigned, Expression const*>* m_matchGroups = nullptr;
 };
 
@@ -28,6 +28,7 @@
 
 #include <cstdlib>
 #include <list>
+#include <memory>
 #include <string>
 
 #include "license.h"
@@ -45,6 +46,9 @@ namespace
 // this may potentially change the pointer that was passed to the caller from solidity_alloc().
 static std::list<std::string> solidityAllocations;
 
+/// Compiler kept between compilations while optimized Yul objects are reused.
+static std::unique_ptr<StandardCompiler> reusingCompiler;
+
 /// Find the equivalent to @p _data in the list of allocations of solidity_alloc(),
 /// removes it from the list and returns its value.
 ///
@@ -107,6 +111,14 @@ ReadCallback::Callback wrapReadCallback(CStyleReadFileCallback _readCallback, vo
 
 std::string compile(std::string _input, CStyleReadFileCallback _readCallback, void* _readContext)
 {
+	if (reusingCompiler)
+	{
+		reusingCompiler->setReadCallback(wrapReadCallback(_readCallback, _readContext));
+		std::string output = reusingCompiler->compile(std::move(_input));
+		reusingCompiler->setReadCallback({});
+		return output;
+	}
+
 	StandardCompiler compiler(wrapReadCallback(_readCallback, _readContext));
 	return compiler.compile(std::move(_input));
 }
@@ -153,7 +165,26 @@ extern void solidity_reset() noexcept
 {
 	// This is called right before each compilation, but not at the end, so additional memory
 	// can be freed here.
-	yul::YulStringRepository::reset();
+	// The cached objects of the reusing compiler refer to YulStrings. It bounds the repository itself.
+	if (!reusingCompiler)
+		yul::YulStringRepository::reset();
 	solidityAllocations.clear();
 }
+
+extern void solidity_set_reuse_optimized_objects(bool _reuse) noexcept
+{
+	if (_reuse == bool(reusingCompiler))
+		return;
+
+	if (_reuse)
+	{
+		reusingCompiler = std::make_unique<StandardCompiler>();
+		reusingCompiler->setReuseOptimizedObjects(true);
+	}
+	else
+	{
+		reusingCompiler.reset();
+		yul::YulStringRepository::reset();
+	}
+}
 }
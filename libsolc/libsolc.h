@@ -94,8 +94,17 @@ char* solidity_compile(char const* _input, CStyleReadFileCallback _readCallback,
 ///
 /// NOTE: the pointer returned by solidity_compile as well as any other pointer retrieved via solidity_alloc()
 /// is invalid after calling this!
+///
+/// Optimized Yul objects kept due to solidity_set_reuse_optimized_objects() are not freed.
 void solidity_reset() SOLC_NOEXCEPT;
 
+/// Enables or disables keeping optimized Yul objects between calls to solidity_compile().
+///
+/// If enabled, later compilations take identical Yul objects, e.g. of unchanged contracts,
+/// from the cache instead of optimizing them again. The output is the same as without the cache.
+/// Disabling it frees the cached objects. Disabled by default.
+void solidity_set_reuse_optimized_objects(bool _reuse) SOLC_NOEXCEPT;
+
 #ifdef __cplusplus
 }
 #endif
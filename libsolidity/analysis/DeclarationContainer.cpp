@@ -26,12 +26,37 @@
 #include <libsolidity/ast/AST.h>
 #include <libsolutil/StringUtils.h>
 
-#include <range/v3/view/filter.hpp>
-#include <range/v3/range/conversion.hpp>
-
 using namespace solidity;
 using namespace solidity::frontend;
 
+namespace
+{
+
+/// Appends the declarations registered under @a _name in @a _declarations to @a _result
+/// using a single lookup.
+void appendDeclarations(
+	std::vector<Declaration const*>& _result,
+	std::map<ASTString, std::vector<Declaration const*>> const& _declarations,
+	ASTString const& _name,
+	bool _onlyVisibleAsUnqualifiedNames
+)
+{
+	auto it = _declarations.find(_name);
+	if (it == _declarations.end())
+		return;
+
+	if (_onlyVisibleAsUnqualifiedNames)
+	{
+		for (Declaration const* declaration: it->second)
+			if (declaration->isVisibleAsUnqualifiedName())
+				_result.push_back(declaration);
+	}
+	else
+		_result += it->second;
+}
+
+}
+
 Declaration const* DeclarationContainer::conflictingDeclaration(
 	Declaration const& _declaration,
 	ASTString const* _name
@@ -41,10 +66,8 @@ Declaration const* DeclarationContainer::conflictingDeclaration(
 		_name = &_declaration.name();
 	solAssert(!_name->empty(), "");
 	std::vector<Declaration const*> declarations;
-	if (m_declarations.count(*_name))
-		declarations += m_declarations.at(*_name);
-	if (m_invisibleDeclarations.count(*_name))
-		declarations += m_invisibleDeclarations.at(*_name);
+	appendDeclarations(declarations, m_declarations, *_name, false);
+	appendDeclarations(declarations, m_invisibleDeclarations, *_name, false);
 
 	if (
 		dynamic_cast<FunctionDefinition const*>(&_declaration) ||
@@ -84,13 +107,15 @@ Declaration const* DeclarationContainer::conflictingDeclaration(
 
 void DeclarationContainer::activateVariable(ASTString const& _name)
 {
+	auto invisible = m_invisibleDeclarations.find(_name);
 	solAssert(
-		m_invisibleDeclarations.count(_name) && m_invisibleDeclarations.at(_name).size() == 1,
+		invisible != m_invisibleDeclarations.end() && invisible->second.size() == 1,
 		"Tried to activate a non-inactive variable or multiple inactive variables with the same name."
 	);
-	solAssert(m_declarations.count(_name) == 0 || m_declarations.at(_name).empty(), "");
-	m_declarations[_name].emplace_back(m_invisibleDeclarations.at(_name).front());
-	m_invisibleDeclarations.erase(_name);
+	std::vector<Declaration const*>& declarations = m_declarations[_name];
+	solAssert(declarations.empty(), "");
+	declarations.emplace_back(invisible->second.front());
+	m_invisibleDeclarations.erase(invisible);
 }
 
 bool DeclarationContainer::isInvisible(ASTString const& _name) const
@@ -149,25 +174,25 @@ std::vector<Declaration const*> DeclarationContainer::resolveName(
 	solAssert(!_name.empty(), "Attempt to resolve empty name.");
 	std::vector<Declaration const*> result;
 
-	if (m_declarations.count(_name))
-	{
-		if (_settings.onlyVisibleAsUnqualifiedNames)
-			result += m_declarations.at(_name) | ranges::views::filter(&Declaration::isVisibleAsUnqualifiedName) | ranges::to_vector;
-		else
-			result += m_declarations.at(_name);
-	}
-
-	if (_settings.alsoInvisible && m_invisibleDeclarations.count(_name))
+	// Walk the chain of enclosing containers iteratively, looking up the name only once per map.
+	for (
+		DeclarationContainer const* container = this;
+		container;
+		container = _settings.recursive ? container->m_enclosingContainer : nullptr
+	)
 	{
-		if (_settings.onlyVisibleAsUnqualifiedNames)
-			result += m_invisibleDeclarations.at(_name) | ranges::views::filter(&Declaration::isVisibleAsUnqualifiedName) | ranges::to_vector;
-		else
-			result += m_invisibleDeclarations.at(_name);
+		appendDeclarations(result, container->m_declarations, _name, _settings.onlyVisibleAsUnqualifiedNames);
+		if (_settings.alsoInvisible)
+			appendDeclarations(
+				result,
+				container->m_invisibleDeclarations,
+				_name,
+				_settings.onlyVisibleAsUnqualifiedNames
+			);
+		if (!result.empty())
+			break;
 	}
 
-	if (result.empty() && _settings.recursive && m_enclosingContainer)
-		result = m_enclosingContainer->resolveName(_name, _settings);
-
 	return result;
 }
 
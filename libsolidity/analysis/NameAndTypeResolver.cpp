@@ -214,12 +214,13 @@ std::vector<Declaration const*> NameAndTypeResolver::pathFromCurrentScopeWithAll
 
 	for (size_t i = 1; i < _path.size() && candidates.size() == 1; i++)
 	{
-		if (!m_scopes.count(candidates.front()))
+		auto scope = m_scopes.find(candidates.front());
+		if (scope == m_scopes.end())
 			return {};
 
 		pathDeclarations.push_back(candidates.front());
 
-		candidates = m_scopes.at(candidates.front())->resolveName(_path[i], settings);
+		candidates = scope->second->resolveName(_path[i], settings);
 	}
 	if (candidates.size() == 1)
 	{
@@ -483,7 +484,7 @@ std::vector<T const*> NameAndTypeResolver::cThreeMerge(std::list<std::list<T con
 }
 
 DeclarationRegistrationHelper::DeclarationRegistrationHelper(
-	std::map<ASTNode const*, std::shared_ptr<DeclarationContainer>>& _scopes,
+	std::unordered_map<ASTNode const*, std::shared_ptr<DeclarationContainer>>& _scopes,
 	ASTNode& _astRoot,
 	ErrorReporter& _errorReporter,
 	GlobalContext& _globalContext,
@@ -33,6 +33,7 @@
 
 #include <list>
 #include <map>
+#include <unordered_map>
 
 namespace solidity::langutil
 {
@@ -128,7 +129,7 @@ private:
 	/// where nullptr denotes the global scope. Note that structs are not scope since they do
 	/// not contain code.
 	/// Aliases (for example `import "x" as y;`) create multiple pointers to the same scope.
-	std::map<ASTNode const*, std::shared_ptr<DeclarationContainer>> m_scopes;
+	std::unordered_map<ASTNode const*, std::shared_ptr<DeclarationContainer>> m_scopes;
 
 	langutil::EVMVersion m_evmVersion;
 	DeclarationContainer* m_currentScope = nullptr;
@@ -149,7 +150,7 @@ public:
 	/// @param _currentScope should be nullptr if we start at SourceUnit, but can be different
 	/// to inject new declarations into an existing scope, used by snippets.
 	DeclarationRegistrationHelper(
-		std::map<ASTNode const*, std::shared_ptr<DeclarationContainer>>& _scopes,
+		std::unordered_map<ASTNode const*, std::shared_ptr<DeclarationContainer>>& _scopes,
 		ASTNode& _astRoot,
 		langutil::ErrorReporter& _errorReporter,
 		GlobalContext& _globalContext,
@@ -183,7 +184,7 @@ private:
 
 	static bool isOverloadedFunction(Declaration const& _declaration1, Declaration const& _declaration2);
 
-	std::map<ASTNode const*, std::shared_ptr<DeclarationContainer>>& m_scopes;
+	std::unordered_map<ASTNode const*, std::shared_ptr<DeclarationContainer>>& m_scopes;
 	ASTNode const* m_currentScope = nullptr;
 	VariableScope* m_currentFunction = nullptr;
 	ContractDefinition const* m_currentContract = nullptr;
@@ -27,7 +27,6 @@
 #include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/ast/AST_accept.h>
 #include <libsolidity/ast/TypeProvider.h>
-#include <libsolutil/FunctionSelector.h>
 #include <libsolutil/Keccak256.h>
 
 #include <range/v3/range/conversion.hpp>
@@ -281,7 +280,8 @@ std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>> const& ContractD
 {
 	return m_interfaceFunctionList[_includeInheritedFunctions].init([&]{
 		std::set<std::string> signaturesSeen;
-		std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>> interfaceFunctionList;
+		std::vector<std::string> signatures;
+		std::vector<FunctionTypePointer> interfaceFunctions;
 
 		for (ContractDefinition const* contract: annotation().linearizedBaseContracts)
 		{
@@ -303,11 +303,20 @@ std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>> const& ContractD
 				if (signaturesSeen.count(functionSignature) == 0)
 				{
 					signaturesSeen.insert(functionSignature);
-					interfaceFunctionList.emplace_back(util::selectorFromSignatureH32(functionSignature), fun);
+					signatures.emplace_back(std::move(functionSignature));
+					interfaceFunctions.push_back(fun);
 				}
 			}
 		}
 
+		std::vector<bytesConstRef> signatureRefs;
+		for (std::string const& signature: signatures)
+			signatureRefs.emplace_back(signature);
+		std::vector<util::h256> hashes = util::keccak256Many(signatureRefs);
+
+		std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>> interfaceFunctionList;
+		for (size_t i = 0; i < interfaceFunctions.size(); ++i)
+			interfaceFunctionList.emplace_back(util::FixedHash<4>(hashes[i], util::FixedHash<4>::AlignLeft), interfaceFunctions[i]);
 		return interfaceFunctionList;
 	});
 }
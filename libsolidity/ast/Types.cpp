@@ -134,6 +134,7 @@ MemberList::Member::Member(Declaration const* _declaration, Type const* _type, s
 void Type::clearCache() const
 {
 	m_members.clear();
+	m_usingForDirectives.clear();
 	m_stackItems.reset();
 	m_stackSize.reset();
 }
@@ -285,17 +286,22 @@ Type const* Type::commonType(Type const* _a, Type const* _b)
 {
 	if (!_a || !_b)
 		return nullptr;
-	else if (_a->mobileType() && _b->isImplicitlyConvertibleTo(*_a->mobileType()))
-		return _a->mobileType();
-	else if (_b->mobileType() && _a->isImplicitlyConvertibleTo(*_b->mobileType()))
-		return _b->mobileType();
-	else
-		return nullptr;
+
+	Type const* mobileA = _a->mobileType();
+	if (mobileA && _b->isImplicitlyConvertibleTo(*mobileA))
+		return mobileA;
+
+	Type const* mobileB = _b->mobileType();
+	if (mobileB && _a->isImplicitlyConvertibleTo(*mobileB))
+		return mobileB;
+
+	return nullptr;
 }
 
 MemberList const& Type::members(ASTNode const* _currentScope) const
 {
-	if (!m_members[_currentScope])
+	std::unique_ptr<MemberList>& memberList = m_members[_currentScope];
+	if (!memberList)
 	{
 		solAssert(
 			_currentScope == nullptr ||
@@ -305,9 +311,9 @@ MemberList const& Type::members(ASTNode const* _currentScope) const
 		MemberList::MemberMap members = nativeMembers(_currentScope);
 		if (_currentScope)
 			members += attachedFunctions(*this, *_currentScope);
-		m_members[_currentScope] = std::make_unique<MemberList>(std::move(members));
+		memberList = std::make_unique<MemberList>(std::move(members));
 	}
-	return *m_members[_currentScope];
+	return *memberList;
 }
 
 Type const* Type::fullEncodingType(bool _inLibraryCall, bool _encoderV2, bool) const
@@ -392,7 +398,7 @@ std::set<FunctionDefinition const*, ASTNode::CompareByID> Type::operatorDefiniti
 		return {};
 
 	std::set<FunctionDefinition const*, ASTNode::CompareByID> matchingDefinitions;
-	for (UsingForDirective const* directive: usingForDirectivesForType(*this, _scope))
+	for (UsingForDirective const* directive: usingForDirectives(_scope))
 		for (auto const& [identifierPath, operator_]: directive->functionsAndOperators())
 		{
 			if (operator_ != _token)
@@ -414,6 +420,14 @@ std::set<FunctionDefinition const*, ASTNode::CompareByID> Type::operatorDefiniti
 	return matchingDefinitions;
 }
 
+std::vector<UsingForDirective const*> const& Type::usingForDirectives(ASTNode const& _scope) const
+{
+	auto [it, inserted] = m_usingForDirectives.try_emplace(&_scope);
+	if (inserted)
+		it->second = usingForDirectivesForType(*this, _scope);
+	return it->second;
+}
+
 MemberList::MemberMap Type::attachedFunctions(Type const& _type, ASTNode const& _scope)
 {
 	MemberList::MemberMap members;
@@ -435,7 +449,7 @@ MemberList::MemberMap Type::attachedFunctions(Type const& _type, ASTNode const&
 				members.emplace_back(&_function, withBoundFirstArgument, *_name);
 	};
 
-	for (UsingForDirective const* ufd: usingForDirectivesForType(_type, _scope))
+	for (UsingForDirective const* ufd: _type.usingForDirectives(_scope))
 		for (auto const& [identifierPath, operator_]: ufd->functionsAndOperators())
 		{
 			if (operator_.has_value())
@@ -1207,10 +1221,14 @@ u256 RationalNumberType::literalValue(Literal const*) const
 
 Type const* RationalNumberType::mobileType() const
 {
-	if (!isFractional())
-		return integerType();
-	else
-		return fixedPointType();
+	if (!m_mobileType.has_value())
+	{
+		if (!isFractional())
+			m_mobileType = integerType();
+		else
+			m_mobileType = fixedPointType();
+	}
+	return *m_mobileType;
 }
 
 IntegerType const* RationalNumberType::integerType() const
@@ -2808,8 +2826,18 @@ std::vector<std::tuple<std::string, Type const*>> TupleType::makeStackItems() co
 	return slots;
 }
 
+void TupleType::clearCache() const
+{
+	Type::clearCache();
+
+	m_mobileType.reset();
+}
+
 Type const* TupleType::mobileType() const
 {
+	if (m_mobileType.has_value())
+		return *m_mobileType;
+
 	TypePointers mobiles;
 	for (auto const& c: components())
 	{
@@ -2817,13 +2845,17 @@ Type const* TupleType::mobileType() const
 		{
 			auto mt = c->mobileType();
 			if (!mt)
+			{
+				m_mobileType = nullptr;
 				return nullptr;
+			}
 			mobiles.push_back(mt);
 		}
 		else
 			mobiles.push_back(nullptr);
 	}
-	return TypeProvider::tuple(std::move(mobiles));
+	m_mobileType = TypeProvider::tuple(std::move(mobiles));
+	return *m_mobileType;
 }
 
 FunctionType::FunctionType(FunctionDefinition const& _function, Kind _kind):
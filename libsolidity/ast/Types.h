@@ -412,6 +412,9 @@ public:
 private:
 	/// @returns a member list containing all members added to this type by `using for` directives.
 	static MemberList::MemberMap attachedFunctions(Type const& _type, ASTNode const& _scope);
+	/// @returns all `using for` directives visible in @a _scope that apply to this type.
+	/// The result is computed once per scope and cached.
+	std::vector<UsingForDirective const*> const& usingForDirectives(ASTNode const& _scope) const;
 
 protected:
 	/// @returns the members native to this type depending on the given context. This function
@@ -430,6 +433,8 @@ protected:
 
 	/// List of member types (parameterised by scape), will be lazy-initialized.
 	mutable std::map<ASTNode const*, std::unique_ptr<MemberList>> m_members;
+	/// `using for` directives applying to this type (parameterised by scope), will be lazy-initialized.
+	mutable std::map<ASTNode const*, std::vector<UsingForDirective const*>> m_usingForDirectives;
 	mutable std::optional<std::vector<std::tuple<std::string, Type const*>>> m_stackItems;
 	mutable std::optional<size_t> m_stackSize;
 };
@@ -636,6 +641,9 @@ private:
 	/// Empty for all rationals that are not directly parsed from hex literals.
 	Type const* m_compatibleBytesType;
 
+	/// Lazy-initialized result of mobileType(), which requires big number arithmetic.
+	mutable std::optional<Type const*> m_mobileType;
+
 	/// @returns true if the literal is a valid rational number.
 	static std::tuple<bool, rational> parseRational(std::string const& _value);
 
@@ -1223,6 +1231,8 @@ public:
 
 	std::vector<Type const*> const& components() const { return m_components; }
 
+	void clearCache() const override;
+
 protected:
 	std::vector<std::tuple<std::string, Type const*>> makeStackItems() const override;
 	std::vector<Type const*> decomposition() const override
@@ -1237,6 +1247,8 @@ protected:
 
 private:
 	std::vector<Type const*> const m_components;
+	/// Lazy-initialized result of mobileType(). Avoids creating a new tuple type on every call.
+	mutable std::optional<Type const*> m_mobileType;
 };
 
 /**
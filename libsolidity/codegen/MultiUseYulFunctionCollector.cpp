@@ -23,6 +23,7 @@
 #include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
 
 #include <liblangutil/Exceptions.h>
+#include <libsolutil/Common.h>
 #include <libsolutil/Whiskers.h>
 #include <libsolutil/StringUtils.h>
 
@@ -30,6 +31,17 @@ using namespace solidity;
 using namespace solidity::frontend;
 using namespace solidity::util;
 
+MultiUseYulFunctionCache::Function const* MultiUseYulFunctionCache::find(std::string const& _name) const
+{
+	auto it = m_functions.find(_name);
+	return it == m_functions.end() ? nullptr : &it->second;
+}
+
+void MultiUseYulFunctionCache::store(std::string const& _name, Function _function)
+{
+	m_functions.emplace(_name, std::move(_function));
+}
+
 std::string MultiUseYulFunctionCollector::requestedFunctions()
 {
 	std::string result = std::move(m_code);
@@ -40,41 +52,129 @@ std::string MultiUseYulFunctionCollector::requestedFunctions()
 
 std::string MultiUseYulFunctionCollector::createFunction(std::string const& _name, std::function<std::string()> const& _creator)
 {
-	if (!m_requestedFunctions.count(_name))
-	{
-		m_requestedFunctions.insert(_name);
-		std::string fun = _creator();
-		solAssert(!fun.empty(), "");
-		solAssert(fun.find("function " + _name + "(") != std::string::npos, "Function not properly named.");
-		m_code += std::move(fun);
-	}
-	return _name;
+	return create(_name, false, functionGenerator(_name, _creator));
 }
 
 std::string MultiUseYulFunctionCollector::createFunction(
 	std::string const& _name,
 	std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
 )
+{
+	return create(_name, false, functionGenerator(_name, _creator));
+}
+
+std::string MultiUseYulFunctionCollector::createReusableFunction(
+	std::string const& _name,
+	std::function<std::string()> const& _creator
+)
+{
+	return create(_name, true, functionGenerator(_name, _creator));
+}
+
+std::string MultiUseYulFunctionCollector::createReusableFunction(
+	std::string const& _name,
+	std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+)
+{
+	return create(_name, true, functionGenerator(_name, _creator));
+}
+
+std::string MultiUseYulFunctionCollector::create(
+	std::string const& _name,
+	bool _reusable,
+	std::function<std::string()> const& _generator
+)
 {
 	solAssert(!_name.empty(), "");
-	if (!m_requestedFunctions.count(_name))
+	if (!m_creationStack.empty())
+	{
+		m_creationStack.back().dependencies.emplace_back(_name);
+		// A function that depends on a contract-specific function is contract-specific as well.
+		if (!_reusable)
+			for (Creation& creation: m_creationStack)
+				creation.reusable = false;
+	}
+
+	if (m_requestedFunctions.count(_name))
+		return _name;
+
+	std::set<std::string> visited;
+	if (_reusable && m_cache && isCached(_name, visited))
 	{
-		m_requestedFunctions.insert(_name);
+		addCachedFunction(_name);
+		return _name;
+	}
+
+	m_requestedFunctions.insert(_name);
+	m_creationStack.emplace_back(Creation{_reusable, {}});
+	ScopeGuard popCreation([&]() { m_creationStack.pop_back(); });
+
+	std::string code = _generator();
+	if (m_cache && m_creationStack.back().reusable)
+		m_cache->store(_name, {code, std::move(m_creationStack.back().dependencies)});
+	m_code += std::move(code);
+	return _name;
+}
+
+bool MultiUseYulFunctionCollector::isCached(std::string const& _name, std::set<std::string>& _visited) const
+{
+	if (m_requestedFunctions.count(_name) || !_visited.insert(_name).second)
+		return true;
+
+	MultiUseYulFunctionCache::Function const* function = m_cache->find(_name);
+	if (!function)
+		return false;
+	for (std::string const& dependency: function->dependencies)
+		if (!isCached(dependency, _visited))
+			return false;
+	return true;
+}
+
+void MultiUseYulFunctionCollector::addCachedFunction(std::string const& _name)
+{
+	MultiUseYulFunctionCache::Function const* function = m_cache->find(_name);
+	solAssert(function);
+
+	m_requestedFunctions.insert(_name);
+	for (std::string const& dependency: function->dependencies)
+		if (!m_requestedFunctions.count(dependency))
+			addCachedFunction(dependency);
+	m_code += function->code;
+}
+
+std::function<std::string()> MultiUseYulFunctionCollector::functionGenerator(
+	std::string const& _name,
+	std::function<std::string()> const& _creator
+)
+{
+	return [name = _name, creator = _creator]() {
+		std::string fun = creator();
+		solAssert(!fun.empty(), "");
+		solAssert(fun.find("function " + name + "(") != std::string::npos, "Function not properly named.");
+		return fun;
+	};
+}
+
+std::function<std::string()> MultiUseYulFunctionCollector::functionGenerator(
+	std::string const& _name,
+	std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+)
+{
+	return [name = _name, creator = _creator]() {
 		std::vector<std::string> arguments;
 		std::vector<std::string> returnParameters;
-		std::string body = _creator(arguments, returnParameters);
+		std::string body = creator(arguments, returnParameters);
 		solAssert(!body.empty(), "");
 
-		m_code += Whiskers(R"(
+		return Whiskers(R"(
 			function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
 				<body>
 			}
 		)")
-		("functionName", _name)
+		("functionName", name)
 		("args", joinHumanReadable(arguments))
 		("retParams", joinHumanReadable(returnParameters))
 		("body", body)
 		.render();
-	}
-	return _name;
+	};
 }
@@ -26,10 +26,37 @@
 #include <map>
 #include <string>
 #include <set>
+#include <vector>
 
 namespace solidity::frontend
 {
 
+/**
+ * Cache of generated Yul functions whose code only depends on their name and on the code
+ * generation settings (EVM version, EOF version and revert strings), but not on the contract
+ * they are generated for. It is meant to be shared between the function collectors of all
+ * contracts of one compilation, which all use the same settings, and has to be cleared
+ * whenever the AST the function names refer to changes.
+ */
+class MultiUseYulFunctionCache
+{
+public:
+	struct Function
+	{
+		std::string code;
+		/// Names of all functions requested while generating the code, in the order of the requests.
+		std::vector<std::string> dependencies;
+	};
+
+	/// @returns the cached function with the given name or nullptr if it is not cached.
+	Function const* find(std::string const& _name) const;
+	void store(std::string const& _name, Function _function);
+	void clear() { m_functions.clear(); }
+
+private:
+	std::map<std::string, Function> m_functions;
+};
+
 /**
  * Container of (unparsed) Yul functions identified by name which are meant to be generated
  * only once.
@@ -37,6 +64,11 @@ namespace solidity::frontend
 class MultiUseYulFunctionCollector
 {
 public:
+	MultiUseYulFunctionCollector() = default;
+	/// @param _cache cache shared with other collectors, used for functions created with
+	/// createReusableFunction(). Can be nullptr.
+	explicit MultiUseYulFunctionCollector(MultiUseYulFunctionCache* _cache): m_cache(_cache) {}
+
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
 	/// cases.
@@ -47,6 +79,18 @@ public:
 		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
 	);
 
+	/// Variants of createFunction for functions whose code only depends on their name and the
+	/// code generation settings. Their code and the functions they depend on are taken from
+	/// the shared cache if available and stored in it otherwise.
+	/// Functions whose code uses anything else, e.g. variable names taken from the call site,
+	/// have to be created with createFunction().
+	std::string createReusableFunction(std::string const& _name, std::function<std::string()> const& _creator);
+
+	std::string createReusableFunction(
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+
 	/// @returns concatenation of all generated functions in the order in which they were
 	/// generated.
 	/// Clears the internal list, i.e. calling it again will result in an
@@ -57,8 +101,36 @@ public:
 	bool contains(std::string const& _name) const { return m_requestedFunctions.count(_name) > 0; }
 
 private:
+	/// Function whose code is currently being generated.
+	struct Creation
+	{
+		bool reusable = true;
+		std::vector<std::string> dependencies;
+	};
+
+	std::string create(std::string const& _name, bool _reusable, std::function<std::string()> const& _generator);
+
+	/// @returns true if the function and all its dependencies missing in this collector are cached.
+	bool isCached(std::string const& _name, std::set<std::string>& _visited) const;
+	/// Adds the cached code of the function and its missing dependencies in the same order
+	/// in which generating them would have added them.
+	void addCachedFunction(std::string const& _name);
+
+	/// @returns a generator for the code of the function that checks the result of @a _creator.
+	/// It holds copies of @a _name and @a _creator, so it can outlive the call that requested the function.
+	static std::function<std::string()> functionGenerator(
+		std::string const& _name,
+		std::function<std::string()> const& _creator
+	);
+	static std::function<std::string()> functionGenerator(
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+
+	MultiUseYulFunctionCache* m_cache = nullptr;
 	std::set<std::string> m_requestedFunctions;
 	std::string m_code;
+	std::vector<Creation> m_creationStack;
 };
 
 }
@@ -59,7 +59,7 @@ std::optional<size_t> staticEncodingSize(std::vector<Type const*> const& _parame
 std::string YulUtilFunctions::identityFunction()
 {
 	std::string functionName = "identity";
-	return m_functionCollector.createFunction("identity", [&](std::vector<std::string>& _args, std::vector<std::string>& _rets) {
+	return m_functionCollector.createReusableFunction("identity", [&](std::vector<std::string>& _args, std::vector<std::string>& _rets) {
 		_args.push_back("value");
 		_rets.push_back("ret");
 		return "ret := value";
@@ -69,7 +69,7 @@ std::string YulUtilFunctions::identityFunction()
 std::string YulUtilFunctions::combineExternalFunctionIdFunction()
 {
 	std::string functionName = "combine_external_function_id";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(addr, selector) -> combined {
 				combined := <shl64>(or(<shl32>(addr), and(selector, 0xffffffff)))
@@ -85,7 +85,7 @@ std::string YulUtilFunctions::combineExternalFunctionIdFunction()
 std::string YulUtilFunctions::splitExternalFunctionIdFunction()
 {
 	std::string functionName = "split_external_function_id";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(combined) -> addr, selector {
 				combined := <shr64>(combined)
@@ -108,7 +108,7 @@ std::string YulUtilFunctions::copyToMemoryFunction(bool _fromCalldata, bool _cle
 		"_to_memory"s +
 		(_cleanup ? "_with_cleanup"s : ""s);
 
-	return m_functionCollector.createFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
+	return m_functionCollector.createReusableFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
 		_args = {"src", "dst", "length"};
 
 		if (_fromCalldata)
@@ -146,7 +146,7 @@ std::string YulUtilFunctions::copyLiteralToMemoryFunction(std::string const& _li
 {
 	std::string functionName = "copy_literal_to_memory_" + util::toHex(util::keccak256(_literal).asBytes());
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>() -> memPtr {
 				memPtr := <arrayAllocationFunction>(<size>)
@@ -165,7 +165,7 @@ std::string YulUtilFunctions::storeLiteralInMemoryFunction(std::string const& _l
 {
 	std::string functionName = "store_literal_in_memory_" + util::toHex(util::keccak256(_literal).asBytes());
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		size_t words = (_literal.length() + 31) / 32;
 		std::vector<std::map<std::string, std::string>> wordParams(words);
 		for (size_t i = 0; i < words; ++i)
@@ -191,7 +191,7 @@ std::string YulUtilFunctions::copyLiteralToStorageFunction(std::string const& _l
 {
 	std::string functionName = "copy_literal_to_storage_" + util::toHex(util::keccak256(_literal).asBytes());
 
-	return m_functionCollector.createFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
+	return m_functionCollector.createReusableFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
 		_args = {"slot"};
 
 		if (_literal.size() >= 32)
@@ -298,6 +298,7 @@ std::string YulUtilFunctions::requireOrAssertFunction(bool _assert, Type const*
 
 	solAssert(!_assert || !_messageType, "Asserts can't have messages!");
 
+	// Not reusable across contracts: the parameter names are derived from the argument expression.
 	return m_functionCollector.createFunction(functionName, [&]() {
 		if (!_messageType)
 			return Whiskers(R"(
@@ -350,6 +351,7 @@ std::string YulUtilFunctions::requireWithErrorFunction(FunctionCall const& error
 			functionParameterNames += IRVariable(*arg).stackSlots();
 	}
 
+	// Not reusable across contracts: the parameter names are derived from the argument expressions.
 	return m_functionCollector.createFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(condition <functionParameterNames>) {
@@ -370,7 +372,7 @@ std::string YulUtilFunctions::requireWithErrorFunction(FunctionCall const& error
 std::string YulUtilFunctions::leftAlignFunction(Type const& _type)
 {
 	std::string functionName = std::string("leftAlign_") + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value) -> aligned {
 				<body>
@@ -432,7 +434,7 @@ std::string YulUtilFunctions::shiftLeftFunction(size_t _numBits)
 	solAssert(_numBits < 256, "");
 
 	std::string functionName = "shift_left_" + std::to_string(_numBits);
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value) -> newValue {
@@ -455,7 +457,7 @@ std::string YulUtilFunctions::shiftLeftFunction(size_t _numBits)
 std::string YulUtilFunctions::shiftLeftFunctionDynamic()
 {
 	std::string functionName = "shift_left_dynamic";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(bits, value) -> newValue {
@@ -481,7 +483,7 @@ std::string YulUtilFunctions::shiftRightFunction(size_t _numBits)
 	// the opcodes SAR and SDIV behave differently with regards to rounding!
 
 	std::string functionName = "shift_right_" + std::to_string(_numBits) + "_unsigned";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value) -> newValue {
@@ -504,7 +506,7 @@ std::string YulUtilFunctions::shiftRightFunction(size_t _numBits)
 std::string YulUtilFunctions::shiftRightFunctionDynamic()
 {
 	std::string const functionName = "shift_right_unsigned_dynamic";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(bits, value) -> newValue {
@@ -525,7 +527,7 @@ std::string YulUtilFunctions::shiftRightFunctionDynamic()
 std::string YulUtilFunctions::shiftRightSignedFunctionDynamic()
 {
 	std::string const functionName = "shift_right_signed_dynamic";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(bits, value) -> result {
@@ -556,7 +558,7 @@ std::string YulUtilFunctions::typedShiftLeftFunction(Type const& _type, Type con
 	solAssert(_amountType.category() == Type::Category::Integer, "");
 	solAssert(!dynamic_cast<IntegerType const&>(_amountType).isSigned(), "");
 	std::string const functionName = "shift_left_" + _type.identifier() + "_" + _amountType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value, bits) -> result {
@@ -582,7 +584,7 @@ std::string YulUtilFunctions::typedShiftRightFunction(Type const& _type, Type co
 	bool valueSigned = integerType && integerType->isSigned();
 
 	std::string const functionName = "shift_right_" + _type.identifier() + "_" + _amountType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value, bits) -> result {
@@ -605,7 +607,7 @@ std::string YulUtilFunctions::updateByteSliceFunction(size_t _numBytes, size_t _
 	size_t numBits = _numBytes * 8;
 	size_t shiftBits = _shiftBytes * 8;
 	std::string functionName = "update_byte_slice_" + std::to_string(_numBytes) + "_shift_" + std::to_string(_shiftBytes);
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value, toInsert) -> result {
@@ -627,7 +629,7 @@ std::string YulUtilFunctions::updateByteSliceFunctionDynamic(size_t _numBytes)
 	solAssert(_numBytes <= 32, "");
 	size_t numBits = _numBytes * 8;
 	std::string functionName = "update_byte_slice_dynamic" + std::to_string(_numBytes);
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value, shiftBytes, toInsert) -> result {
@@ -648,7 +650,7 @@ std::string YulUtilFunctions::updateByteSliceFunctionDynamic(size_t _numBytes)
 std::string YulUtilFunctions::maskBytesFunctionDynamic()
 {
 	std::string functionName = "mask_bytes_dynamic";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(data, bytes) -> result {
 				let mask := not(<shr>(mul(8, bytes), not(0)))
@@ -664,7 +666,7 @@ std::string YulUtilFunctions::maskLowerOrderBytesFunction(size_t _bytes)
 {
 	std::string functionName = "mask_lower_order_bytes_" + std::to_string(_bytes);
 	solAssert(_bytes <= 32, "");
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(data) -> result {
 				result := and(data, <mask>)
@@ -678,7 +680,7 @@ std::string YulUtilFunctions::maskLowerOrderBytesFunction(size_t _bytes)
 std::string YulUtilFunctions::maskLowerOrderBytesFunctionDynamic()
 {
 	std::string functionName = "mask_lower_order_bytes_dynamic";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(data, bytes) -> result {
 				let mask := not(<shl>(mul(8, bytes), not(0)))
@@ -693,7 +695,7 @@ std::string YulUtilFunctions::maskLowerOrderBytesFunctionDynamic()
 std::string YulUtilFunctions::roundUpFunction()
 {
 	std::string functionName = "round_up_to_mul_of_32";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value) -> result {
@@ -707,7 +709,7 @@ std::string YulUtilFunctions::roundUpFunction()
 
 std::string YulUtilFunctions::divide32CeilFunction()
 {
-	return m_functionCollector.createFunction(
+	return m_functionCollector.createReusableFunction(
 		"divide_by_32_ceil",
 		[&](std::vector<std::string>& _args, std::vector<std::string>& _ret) {
 			_args = {"value"};
@@ -720,7 +722,7 @@ std::string YulUtilFunctions::divide32CeilFunction()
 std::string YulUtilFunctions::overflowCheckedIntAddFunction(IntegerType const& _type)
 {
 	std::string functionName = "checked_add_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> sum {
@@ -764,7 +766,7 @@ std::string YulUtilFunctions::overflowCheckedIntAddFunction(IntegerType const& _
 std::string YulUtilFunctions::wrappingIntAddFunction(IntegerType const& _type)
 {
 	std::string functionName = "wrapping_add_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> sum {
@@ -780,7 +782,7 @@ std::string YulUtilFunctions::wrappingIntAddFunction(IntegerType const& _type)
 std::string YulUtilFunctions::overflowCheckedIntMulFunction(IntegerType const& _type)
 {
 	std::string functionName = "checked_mul_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			// Multiplication by zero could be treated separately and directly return zero.
 			Whiskers(R"(
@@ -834,7 +836,7 @@ std::string YulUtilFunctions::overflowCheckedIntMulFunction(IntegerType const& _
 std::string YulUtilFunctions::wrappingIntMulFunction(IntegerType const& _type)
 {
 	std::string functionName = "wrapping_mul_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> product {
@@ -850,7 +852,7 @@ std::string YulUtilFunctions::wrappingIntMulFunction(IntegerType const& _type)
 std::string YulUtilFunctions::overflowCheckedIntDivFunction(IntegerType const& _type)
 {
 	std::string functionName = "checked_div_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> r {
@@ -880,7 +882,7 @@ std::string YulUtilFunctions::overflowCheckedIntDivFunction(IntegerType const& _
 std::string YulUtilFunctions::wrappingIntDivFunction(IntegerType const& _type)
 {
 	std::string functionName = "wrapping_div_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> r {
@@ -901,7 +903,7 @@ std::string YulUtilFunctions::wrappingIntDivFunction(IntegerType const& _type)
 std::string YulUtilFunctions::intModFunction(IntegerType const& _type)
 {
 	std::string functionName = "mod_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> r {
@@ -922,7 +924,7 @@ std::string YulUtilFunctions::intModFunction(IntegerType const& _type)
 std::string YulUtilFunctions::overflowCheckedIntSubFunction(IntegerType const& _type)
 {
 	std::string functionName = "checked_sub_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createReusableFunction(functionName, [&] {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> diff {
@@ -966,7 +968,7 @@ std::string YulUtilFunctions::overflowCheckedIntSubFunction(IntegerType const& _
 std::string YulUtilFunctions::wrappingIntSubFunction(IntegerType const& _type)
 {
 	std::string functionName = "wrapping_sub_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createReusableFunction(functionName, [&] {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> diff {
@@ -987,7 +989,7 @@ std::string YulUtilFunctions::overflowCheckedIntExpFunction(
 	solAssert(!_exponentType.isSigned(), "");
 
 	std::string functionName = "checked_exp_" + _type.identifier() + "_" + _exponentType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(base, exponent) -> power {
@@ -1024,7 +1026,7 @@ std::string YulUtilFunctions::overflowCheckedIntLiteralExpFunction(
 
 	std::string functionName = "checked_exp_" + _baseType.richIdentifier() + "_" + _exponentType.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]()
+	return m_functionCollector.createReusableFunction(functionName, [&]()
 	{
 		// Converts a bigint number into u256 (negative numbers represented in two's complement form.)
 		// We assume that `_v` fits in 256 bits.
@@ -1138,7 +1140,7 @@ std::string YulUtilFunctions::overflowCheckedUnsignedExpFunction()
 	solAssert(pow(bigint(306), 32) >= pow(bigint(2), 256), "");
 
 	std::string functionName = "checked_exp_unsigned";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(base, exponent, max) -> power {
@@ -1186,7 +1188,7 @@ std::string YulUtilFunctions::overflowCheckedUnsignedExpFunction()
 std::string YulUtilFunctions::overflowCheckedSignedExpFunction()
 {
 	std::string functionName = "checked_exp_signed";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(base, exponent, min, max) -> power {
@@ -1242,7 +1244,7 @@ std::string YulUtilFunctions::overflowCheckedExpLoopFunction()
 	// This function does not include the final multiplication.
 
 	std::string functionName = "checked_exp_helper";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(_power, _base, exponent, max) -> power, base {
@@ -1281,7 +1283,7 @@ std::string YulUtilFunctions::wrappingIntExpFunction(
 	solAssert(!_exponentType.isSigned(), "");
 
 	std::string functionName = "wrapping_exp_" + _type.identifier() + "_" + _exponentType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(base, exponent) -> power {
@@ -1300,7 +1302,7 @@ std::string YulUtilFunctions::wrappingIntExpFunction(
 std::string YulUtilFunctions::arrayLengthFunction(ArrayType const& _type)
 {
 	std::string functionName = "array_length_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers w(R"(
 			function <functionName>(value<?dynamic><?calldata>, len</calldata></dynamic>) -> length {
 				<?dynamic>
@@ -1342,7 +1344,7 @@ std::string YulUtilFunctions::arrayLengthFunction(ArrayType const& _type)
 std::string YulUtilFunctions::extractByteArrayLengthFunction()
 {
 	std::string functionName = "extract_byte_array_length";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers w(R"(
 			function <functionName>(data) -> length {
 				length := div(data, 2)
@@ -1371,7 +1373,7 @@ std::string YulUtilFunctions::resizeArrayFunction(ArrayType const& _type)
 		return resizeDynamicByteArrayFunction(_type);
 
 	std::string functionName = "resize_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(array, newLen) {
 				if gt(newLen, <maxArrayLength>) {
@@ -1410,7 +1412,7 @@ std::string YulUtilFunctions::cleanUpStorageArrayEndFunction(ArrayType const& _t
 	solUnimplementedAssert(_type.baseType()->storageBytes() <= 32);
 
 	std::string functionName = "cleanup_storage_array_end_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
+	return m_functionCollector.createReusableFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
 		_args = {"array", "len", "startIndex"};
 		return Whiskers(R"(
 			if lt(startIndex, len) {
@@ -1443,7 +1445,7 @@ std::string YulUtilFunctions::cleanUpStorageArrayEndFunction(ArrayType const& _t
 std::string YulUtilFunctions::resizeDynamicByteArrayFunction(ArrayType const& _type)
 {
 	std::string functionName = "resize_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
+	return m_functionCollector.createReusableFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
 		_args = {"array", "newLen"};
 		return Whiskers(R"(
 			let data := sload(array)
@@ -1470,7 +1472,7 @@ std::string YulUtilFunctions::cleanUpDynamicByteArrayEndSlotsFunction(ArrayType
 	solAssert(_type.isDynamicallySized(), "");
 
 	std::string functionName = "clean_up_bytearray_end_slots_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
+	return m_functionCollector.createReusableFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
 		_args = {"array", "len", "startIndex"};
 		return Whiskers(R"(
 			if gt(len, 31) {
@@ -1491,7 +1493,7 @@ std::string YulUtilFunctions::cleanUpDynamicByteArrayEndSlotsFunction(ArrayType
 std::string YulUtilFunctions::decreaseByteArraySizeFunction(ArrayType const& _type)
 {
 	std::string functionName = "byte_array_decrease_size_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array, data, oldLen, newLen) {
 				switch lt(newLen, 32)
@@ -1534,7 +1536,7 @@ std::string YulUtilFunctions::decreaseByteArraySizeFunction(ArrayType const& _ty
 std::string YulUtilFunctions::increaseByteArraySizeFunction(ArrayType const& _type)
 {
 	std::string functionName = "byte_array_increase_size_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
+	return m_functionCollector.createReusableFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
 		_args = {"array", "data", "oldLen", "newLen"};
 		return Whiskers(R"(
 			if gt(newLen, <maxArrayLength>) { <panic>() }
@@ -1569,7 +1571,7 @@ std::string YulUtilFunctions::increaseByteArraySizeFunction(ArrayType const& _ty
 std::string YulUtilFunctions::byteArrayTransitLongToShortFunction(ArrayType const& _type)
 {
 	std::string functionName = "transit_byte_array_long_to_short_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array, len) {
 				// we need to copy elements from old array to new
@@ -1589,7 +1591,7 @@ std::string YulUtilFunctions::byteArrayTransitLongToShortFunction(ArrayType cons
 std::string YulUtilFunctions::shortByteArrayEncodeUsedAreaSetLengthFunction()
 {
 	std::string functionName = "extract_used_part_and_set_length_of_short_byte_array";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(data, len) -> used {
 				// we want to save only elements that are part of the array after resizing
@@ -1605,7 +1607,7 @@ std::string YulUtilFunctions::shortByteArrayEncodeUsedAreaSetLengthFunction()
 
 std::string YulUtilFunctions::longByteArrayStorageIndexAccessNoCheckFunction()
 {
-	return m_functionCollector.createFunction(
+	return m_functionCollector.createReusableFunction(
 		"long_byte_array_index_access_no_checks",
 		[&](std::vector<std::string>& _args, std::vector<std::string>& _returnParams) {
 			_args = {"array", "index"};
@@ -1630,7 +1632,7 @@ std::string YulUtilFunctions::storageArrayPopFunction(ArrayType const& _type)
 		return storageByteArrayPopFunction(_type);
 
 	std::string functionName = "array_pop_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array) {
 				let oldLen := <fetchLength>(array)
@@ -1659,7 +1661,7 @@ std::string YulUtilFunctions::storageByteArrayPopFunction(ArrayType const& _type
 	solAssert(_type.isByteArrayOrString(), "");
 
 	std::string functionName = "byte_array_pop_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array) {
 				let data := sload(array)
@@ -1710,7 +1712,7 @@ std::string YulUtilFunctions::storageArrayPushFunction(ArrayType const& _type, T
 		_fromType->identifier() +
 		"_to_" +
 		_type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array <values>) {
 				<?isByteArrayOrString>
@@ -1774,7 +1776,7 @@ std::string YulUtilFunctions::storageArrayPushZeroFunction(ArrayType const& _typ
 	solUnimplementedAssert(_type.baseType()->storageBytes() <= 32, "Base type is not yet implemented.");
 
 	std::string functionName = "array_push_zero_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array) -> slot, offset {
 				<?isBytes>
@@ -1803,7 +1805,7 @@ std::string YulUtilFunctions::storageArrayPushZeroFunction(ArrayType const& _typ
 std::string YulUtilFunctions::partialClearStorageSlotFunction()
 {
 	std::string functionName = "partial_clear_storage_slot";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 		function <functionName>(slot, offset) {
 			let mask := <shr>(mul(8, sub(32, offset)), <ones>)
@@ -1824,7 +1826,7 @@ std::string YulUtilFunctions::clearStorageRangeFunction(Type const& _type)
 
 	std::string functionName = "clear_storage_range_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(start, end) {
 				for {} lt(start, end) { start := add(start, <increment>) }
@@ -1855,7 +1857,7 @@ std::string YulUtilFunctions::clearStorageArrayFunction(ArrayType const& _type)
 
 	std::string functionName = "clear_storage_array_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(slot) {
 				<?dynamic>
@@ -1886,7 +1888,7 @@ std::string YulUtilFunctions::clearStorageStructFunction(StructType const& _type
 
 	std::string functionName = "clear_struct_storage_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createReusableFunction(functionName, [&] {
 		MemberList::MemberMap structMembers = _type.nativeMembers(nullptr);
 		std::vector<std::map<std::string, std::string>> memberSetValues;
 
@@ -1951,7 +1953,7 @@ std::string YulUtilFunctions::copyArrayToStorageFunction(ArrayType const& _fromT
 	solAssert(!_fromType.baseType()->isValueType());
 
 	std::string functionName = "copy_array_to_storage_from_" + _fromType.identifier() + "_to_" + _toType.identifier();
-	return m_functionCollector.createFunction(functionName, [&](){
+	return m_functionCollector.createReusableFunction(functionName, [&](){
 		Whiskers templ(R"(
 			function <functionName>(slot, value<?isFromDynamicCalldata>, len</isFromDynamicCalldata>) {
 				<?fromStorage> if eq(slot, value) { leave } </fromStorage>
@@ -2040,7 +2042,7 @@ std::string YulUtilFunctions::copyByteArrayToStorageFunction(ArrayType const& _f
 	solAssert(_toType.isByteArrayOrString(), "");
 
 	std::string functionName = "copy_byte_array_to_storage_from_" + _fromType.identifier() + "_to_" + _toType.identifier();
-	return m_functionCollector.createFunction(functionName, [&](){
+	return m_functionCollector.createReusableFunction(functionName, [&](){
 		Whiskers templ(R"(
 			function <functionName>(slot, src<?fromCalldata>, len</fromCalldata>) {
 				<?fromStorage> if eq(slot, src) { leave } </fromStorage>
@@ -2121,7 +2123,7 @@ std::string YulUtilFunctions::copyValueArrayToStorageFunction(ArrayType const& _
 	solAssert(_toType.storageStride() <= 32, "");
 
 	std::string functionName = "copy_array_to_storage_from_" + _fromType.identifier() + "_to_" + _toType.identifier();
-	return m_functionCollector.createFunction(functionName, [&](){
+	return m_functionCollector.createReusableFunction(functionName, [&](){
 		Whiskers templ(R"(
 			function <functionName>(dst, src<?isFromDynamicCalldata>, len</isFromDynamicCalldata>) {
 				<?isFromStorage>
@@ -2279,7 +2281,7 @@ std::string YulUtilFunctions::copyValueArrayToStorageFunction(ArrayType const& _
 std::string YulUtilFunctions::arrayConvertLengthToSize(ArrayType const& _type)
 {
 	std::string functionName = "array_convert_length_to_size_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Type const& baseType = *_type.baseType();
 
 		switch (_type.location())
@@ -2333,7 +2335,7 @@ std::string YulUtilFunctions::arrayAllocationSizeFunction(ArrayType const& _type
 {
 	solAssert(_type.dataStoredIn(DataLocation::Memory), "");
 	std::string functionName = "array_allocation_size_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers w(R"(
 			function <functionName>(length) -> size {
 				// Make sure we can allocate memory without overflow
@@ -2361,7 +2363,7 @@ std::string YulUtilFunctions::arrayAllocationSizeFunction(ArrayType const& _type
 std::string YulUtilFunctions::arrayDataAreaFunction(ArrayType const& _type)
 {
 	std::string functionName = "array_dataslot_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		// No special processing for calldata arrays, because they are stored as
 		// offset of the data area and length on the stack, so the offset already
 		// points to the data area.
@@ -2392,7 +2394,7 @@ std::string YulUtilFunctions::arrayDataAreaFunction(ArrayType const& _type)
 std::string YulUtilFunctions::storageArrayIndexAccessFunction(ArrayType const& _type)
 {
 	std::string functionName = "storage_array_index_access_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array, index) -> slot, offset {
 				let arrayLength := <arrayLen>(array)
@@ -2437,7 +2439,7 @@ std::string YulUtilFunctions::storageArrayIndexAccessFunction(ArrayType const& _
 std::string YulUtilFunctions::memoryArrayIndexAccessFunction(ArrayType const& _type)
 {
 	std::string functionName = "memory_array_index_access_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(baseRef, index) -> addr {
 				if iszero(lt(index, <arrayLen>(baseRef))) {
@@ -2464,7 +2466,7 @@ std::string YulUtilFunctions::calldataArrayIndexAccessFunction(ArrayType const&
 {
 	solAssert(_type.dataStoredIn(DataLocation::CallData), "");
 	std::string functionName = "calldata_array_index_access_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(base_ref<?dynamicallySized>, length</dynamicallySized>, index) -> addr<?dynamicallySizedBase>, len</dynamicallySizedBase> {
 				if iszero(lt(index, <?dynamicallySized>length<!dynamicallySized><arrayLen></dynamicallySized>)) { <panic>() }
@@ -2491,7 +2493,7 @@ std::string YulUtilFunctions::calldataArrayIndexRangeAccess(ArrayType const& _ty
 	solAssert(_type.dataStoredIn(DataLocation::CallData), "");
 	solAssert(_type.isDynamicallySized(), "");
 	std::string functionName = "calldata_array_index_range_access_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(offset, length, startIndex, endIndex) -> offsetOut, lengthOut {
 				if gt(startIndex, endIndex) { <revertSliceStartAfterEnd>() }
@@ -2513,7 +2515,7 @@ std::string YulUtilFunctions::accessCalldataTailFunction(Type const& _type)
 	solAssert(_type.isDynamicallyEncoded(), "");
 	solAssert(_type.dataStoredIn(DataLocation::CallData), "");
 	std::string functionName = "access_calldata_tail_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(base_ref, ptr_to_tail) -> addr<?dynamicallySized>, length</dynamicallySized> {
 				let rel_offset_of_tail := calldataload(ptr_to_tail)
@@ -2544,7 +2546,7 @@ std::string YulUtilFunctions::nextArrayElementFunction(ArrayType const& _type)
 	if (_type.dataStoredIn(DataLocation::Storage))
 		solAssert(_type.baseType()->storageBytes() > 16, "");
 	std::string functionName = "array_nextElement_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(ptr) -> next {
 				next := add(ptr, <advance>)
@@ -2588,7 +2590,7 @@ std::string YulUtilFunctions::copyArrayFromStorageToMemoryFunction(ArrayType con
 
 	std::string functionName = "copy_array_from_storage_to_memory_" + _from.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		if (_from.baseType()->isValueType())
 		{
 			solAssert(*_from.baseType() == *_to.baseType(), "");
@@ -2681,7 +2683,7 @@ std::string YulUtilFunctions::bytesOrStringConcatFunction(
 		totalParams += argumentType->sizeOnStack();
 		functionName += "_" + argumentType->identifier();
 	}
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(<parameters>) -> outPtr {
 				outPtr := <allocateUnbounded>()
@@ -2709,7 +2711,7 @@ std::string YulUtilFunctions::bytesOrStringConcatFunction(
 std::string YulUtilFunctions::mappingIndexAccessFunction(MappingType const& _mappingType, Type const& _keyType)
 {
 	std::string functionName = "mapping_index_access_" + _mappingType.identifier() + "_of_" + _keyType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		if (_mappingType.keyType()->isDynamicallySized())
 			return Whiskers(R"(
 				function <functionName>(slot <?+key>,</+key> <key>) -> dataSlot {
@@ -2778,7 +2780,7 @@ std::string YulUtilFunctions::readFromStorageDynamic(
 		std::string(_splitFunctionTypes ? "split_" : "") +
 		_type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createReusableFunction(functionName, [&] {
 		return Whiskers(R"(
 			function <functionName>(slot, offset) -> value {
 				if gt(offset, 0) { <panic>() }
@@ -2818,7 +2820,7 @@ std::string YulUtilFunctions::readFromStorageValueType(
 		"_" +
 		_type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createReusableFunction(functionName, [&] {
 		Whiskers templ(R"(
 			function <functionName>(slot<?dynamic>, offset</dynamic>) -> <?split>addr, selector<!split>value</split> {
 				<?split>let</split> value := <extract>(<loadOpcode>(slot)<?dynamic>, offset</dynamic>)
@@ -2880,7 +2882,7 @@ std::string YulUtilFunctions::readFromStorageReferenceType(Type const& _type)
 		.render();
 	}
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createReusableFunction(functionName, [&] {
 		return Whiskers(R"(
 			function <functionName>(slot) -> value {
 				value := <allocStruct>()
@@ -2928,7 +2930,7 @@ std::string YulUtilFunctions::updateStorageValueFunction(
 		"_to_" +
 		_toType.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createReusableFunction(functionName, [&] {
 		if (_toType.isValueType())
 		{
 			solAssert(_fromType.isImplicitlyConvertibleTo(_toType), "");
@@ -3034,7 +3036,7 @@ std::string YulUtilFunctions::writeToMemoryFunction(Type const& _type)
 {
 	std::string const functionName = "write_to_memory_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createReusableFunction(functionName, [&] {
 		solAssert(!dynamic_cast<StringLiteralType const*>(&_type), "");
 		if (auto ref = dynamic_cast<ReferenceType const*>(&_type))
 		{
@@ -3091,7 +3093,7 @@ std::string YulUtilFunctions::extractFromStorageValueDynamic(Type const& _type)
 	std::string functionName =
 		"extract_from_storage_value_dynamic" +
 		_type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createReusableFunction(functionName, [&] {
 		return Whiskers(R"(
 			function <functionName>(slot_value, offset) -> value {
 				value := <cleanupStorage>(<shr>(mul(offset, 8), slot_value))
@@ -3107,7 +3109,7 @@ std::string YulUtilFunctions::extractFromStorageValueDynamic(Type const& _type)
 std::string YulUtilFunctions::extractFromStorageValue(Type const& _type, size_t _offset)
 {
 	std::string functionName = "extract_from_storage_value_offset_" + std::to_string(_offset) + "_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createReusableFunction(functionName, [&] {
 		return Whiskers(R"(
 			function <functionName>(slot_value) -> value {
 				value := <cleanupStorage>(<shr>(slot_value))
@@ -3125,7 +3127,7 @@ std::string YulUtilFunctions::cleanupFromStorageFunction(Type const& _type)
 	solAssert(_type.isValueType(), "");
 
 	std::string functionName = std::string("cleanup_from_storage_") + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createReusableFunction(functionName, [&] {
 		Whiskers templ(R"(
 			function <functionName>(value) -> cleaned {
 				cleaned := <cleaned>
@@ -3158,7 +3160,7 @@ std::string YulUtilFunctions::cleanupFromStorageFunction(Type const& _type)
 std::string YulUtilFunctions::prepareStoreFunction(Type const& _type)
 {
 	std::string functionName = "prepare_store_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		solAssert(_type.isValueType(), "");
 		auto const* funType = dynamic_cast<FunctionType const*>(&_type);
 		if (funType && funType->kind() == FunctionType::Kind::External)
@@ -3194,7 +3196,7 @@ std::string YulUtilFunctions::prepareStoreFunction(Type const& _type)
 std::string YulUtilFunctions::allocationFunction()
 {
 	std::string functionName = "allocate_memory";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(size) -> memPtr {
 				memPtr := <allocateUnbounded>()
@@ -3211,7 +3213,7 @@ std::string YulUtilFunctions::allocationFunction()
 std::string YulUtilFunctions::allocateUnboundedFunction()
 {
 	std::string functionName = "allocate_unbounded";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>() -> memPtr {
 				memPtr := mload(<freeMemoryPointer>)
@@ -3226,7 +3228,7 @@ std::string YulUtilFunctions::allocateUnboundedFunction()
 std::string YulUtilFunctions::finalizeAllocationFunction()
 {
 	std::string functionName = "finalize_allocation";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(memPtr, size) {
 				let newFreePtr := add(memPtr, <roundUp>(size))
@@ -3255,7 +3257,7 @@ std::string YulUtilFunctions::zeroMemoryFunction(Type const& _type)
 	solAssert(_type.hasSimpleZeroValueInMemory(), "");
 
 	std::string functionName = "zero_memory_chunk_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(dataStart, dataSizeInBytes) {
 				calldatacopy(dataStart, calldatasize(), dataSizeInBytes)
@@ -3271,7 +3273,7 @@ std::string YulUtilFunctions::zeroComplexMemoryArrayFunction(ArrayType const& _t
 	solAssert(!_type.baseType()->hasSimpleZeroValueInMemory(), "");
 
 	std::string functionName = "zero_complex_memory_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		solAssert(_type.memoryStride() == 32, "");
 		return Whiskers(R"(
 			function <functionName>(dataStart, dataSizeInBytes) {
@@ -3290,7 +3292,7 @@ std::string YulUtilFunctions::zeroComplexMemoryArrayFunction(ArrayType const& _t
 std::string YulUtilFunctions::allocateMemoryArrayFunction(ArrayType const& _type)
 {
 	std::string functionName = "allocate_memory_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 				function <functionName>(length) -> memPtr {
 					let allocSize := <allocSize>(length)
@@ -3311,7 +3313,7 @@ std::string YulUtilFunctions::allocateMemoryArrayFunction(ArrayType const& _type
 std::string YulUtilFunctions::allocateAndInitializeMemoryArrayFunction(ArrayType const& _type)
 {
 	std::string functionName = "allocate_and_zero_memory_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 				function <functionName>(length) -> memPtr {
 					memPtr := <allocArray>(length)
@@ -3336,7 +3338,7 @@ std::string YulUtilFunctions::allocateAndInitializeMemoryArrayFunction(ArrayType
 std::string YulUtilFunctions::allocateMemoryStructFunction(StructType const& _type)
 {
 	std::string functionName = "allocate_memory_struct_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers templ(R"(
 		function <functionName>() -> memPtr {
 			memPtr := <alloc>(<allocSize>)
@@ -3353,7 +3355,7 @@ std::string YulUtilFunctions::allocateMemoryStructFunction(StructType const& _ty
 std::string YulUtilFunctions::allocateAndInitializeMemoryStructFunction(StructType const& _type)
 {
 	std::string functionName = "allocate_and_zero_memory_struct_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers templ(R"(
 		function <functionName>() -> memPtr {
 			memPtr := <allocStruct>()
@@ -3412,7 +3414,7 @@ std::string YulUtilFunctions::conversionFunction(Type const& _from, Type const&
 			_from.identifier() +
 			"_to_" +
 			_to.identifier();
-		return m_functionCollector.createFunction(functionName, [&]() {
+		return m_functionCollector.createReusableFunction(functionName, [&]() {
 			return Whiskers(R"(
 				function <functionName>(<?external>addr, </external>functionId) -> <?external>outAddr, </external>outFunctionId {
 					<?external>outAddr := addr</external>
@@ -3453,7 +3455,7 @@ std::string YulUtilFunctions::conversionFunction(Type const& _from, Type const&
 			_from.identifier() +
 			"_to_" +
 			_to.identifier();
-		return m_functionCollector.createFunction(functionName, [&]() {
+		return m_functionCollector.createReusableFunction(functionName, [&]() {
 			return Whiskers(R"(
 				function <functionName>(offset, length) -> outOffset, outLength {
 					outOffset := offset
@@ -3484,7 +3486,7 @@ std::string YulUtilFunctions::conversionFunction(Type const& _from, Type const&
 		_from.identifier() +
 		"_to_" +
 		_to.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value) -> converted {
 				<body>
@@ -3676,7 +3678,7 @@ std::string YulUtilFunctions::bytesToFixedBytesConversionFunction(ArrayType cons
 	solAssert(_from.isByteArray(), "");
 	solAssert(_from.isDynamicallySized(), "");
 	std::string functionName = "convert_bytes_to_fixedbytes_from_" + _from.identifier() + "_to_" + _to.identifier();
-	return m_functionCollector.createFunction(functionName, [&](auto& _args, auto& _returnParams) {
+	return m_functionCollector.createReusableFunction(functionName, [&](auto& _args, auto& _returnParams) {
 		_args = { "array" };
 		bool fromCalldata = _from.dataStoredIn(DataLocation::CallData);
 		if (fromCalldata)
@@ -3740,7 +3742,7 @@ std::string YulUtilFunctions::copyStructToStorageFunction(StructType const& _fro
 		"_to_" +
 		_to.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&](auto& _arguments, auto&) {
+	return m_functionCollector.createReusableFunction(functionName, [&](auto& _arguments, auto&) {
 		_arguments = {"slot", "value"};
 		Whiskers templ(R"(
 			<?fromStorage> if iszero(eq(slot, value)) { </fromStorage>
@@ -3865,7 +3867,7 @@ std::string YulUtilFunctions::arrayConversionFunction(ArrayType const& _from, Ar
 		"_to_" +
 		_to.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value<?fromCalldataDynamic>, length</fromCalldataDynamic>) -> converted <?toCalldataDynamic>, outLength</toCalldataDynamic> {
 				<body>
@@ -3932,7 +3934,7 @@ std::string YulUtilFunctions::cleanupFunction(Type const& _type)
 		return cleanupFunction(userDefinedValueType->underlyingType());
 
 	std::string functionName = std::string("cleanup_") + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value) -> cleaned {
 				<body>
@@ -4029,7 +4031,7 @@ std::string YulUtilFunctions::cleanupFunction(Type const& _type)
 std::string YulUtilFunctions::validatorFunction(Type const& _type, bool _revertOnFailure)
 {
 	std::string functionName = std::string("validator_") + (_revertOnFailure ? "revert_" : "assert_") + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value) {
 				if iszero(<condition>) { <failure> }
@@ -4094,7 +4096,7 @@ std::string YulUtilFunctions::packedHashFunction(
 	size_t sizeOnStack = 0;
 	for (Type const* t: _givenTypes)
 		sizeOnStack += t->sizeOnStack();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(<variables>) -> hash {
 				let pos := <allocateUnbounded>()
@@ -4118,7 +4120,7 @@ std::string YulUtilFunctions::forwardingRevertFunction()
 {
 	bool forward = m_evmVersion.supportsReturndata();
 	std::string functionName = "revert_forward_" + std::to_string(forward);
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		if (forward)
 			return Whiskers(R"(
 				function <functionName>() {
@@ -4148,7 +4150,7 @@ std::string YulUtilFunctions::decrementCheckedFunction(Type const& _type)
 
 	std::string const functionName = "decrement_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(value) -> ret {
 				value := <cleanupFunction>(value)
@@ -4171,7 +4173,7 @@ std::string YulUtilFunctions::decrementWrappingFunction(Type const& _type)
 
 	std::string const functionName = "decrement_wrapping_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(value) -> ret {
 				ret := <cleanupFunction>(sub(value, 1))
@@ -4190,7 +4192,7 @@ std::string YulUtilFunctions::incrementCheckedFunction(Type const& _type)
 
 	std::string const functionName = "increment_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(value) -> ret {
 				value := <cleanupFunction>(value)
@@ -4213,7 +4215,7 @@ std::string YulUtilFunctions::incrementWrappingFunction(Type const& _type)
 
 	std::string const functionName = "increment_wrapping_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(value) -> ret {
 				ret := <cleanupFunction>(add(value, 1))
@@ -4232,7 +4234,7 @@ std::string YulUtilFunctions::negateNumberCheckedFunction(Type const& _type)
 	solAssert(type.isSigned(), "Expected signed type!");
 
 	std::string const functionName = "negate_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(value) -> ret {
 				value := <cleanupFunction>(value)
@@ -4255,7 +4257,7 @@ std::string YulUtilFunctions::negateNumberWrappingFunction(Type const& _type)
 	solAssert(type.isSigned(), "Expected signed type!");
 
 	std::string const functionName = "negate_wrapping_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(value) -> ret {
 				ret := <cleanupFunction>(sub(0, value))
@@ -4273,7 +4275,7 @@ std::string YulUtilFunctions::zeroValueFunction(Type const& _type, bool _splitFu
 
 	std::string const functionName = "zero_value_for_" + std::string(_splitFunctionTypes ? "split_" : "") + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		FunctionType const* fType = dynamic_cast<FunctionType const*>(&_type);
 		if (fType && fType->kind() == FunctionType::Kind::External && _splitFunctionTypes)
 			return Whiskers(R"(
@@ -4346,7 +4348,7 @@ std::string YulUtilFunctions::storageSetToZeroFunction(Type const& _type, Variab
 {
 	std::string const functionName = "storage_set_to_zero_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		if (_type.isValueType())
 			return Whiskers(R"(
 				function <functionName>(slot, offset) {
@@ -4393,7 +4395,7 @@ std::string YulUtilFunctions::conversionFunctionSpecial(Type const& _from, Type
 		_from.identifier() +
 		"_to_" +
 		_to.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		if (
 			auto fromTuple = dynamic_cast<TupleType const*>(&_from), toTuple = dynamic_cast<TupleType const*>(&_to);
 			fromTuple && toTuple && fromTuple->components().size() == toTuple->components().size()
@@ -4485,7 +4487,7 @@ std::string YulUtilFunctions::readFromMemoryOrCalldata(Type const& _type, bool _
 	if (_fromCalldata)
 		solAssert(!_type.isDynamicallyEncoded(), "");
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createReusableFunction(functionName, [&] {
 		if (auto refType = dynamic_cast<ReferenceType const*>(&_type))
 		{
 			solAssert(refType->sizeOnStack() == 1, "");
@@ -4545,7 +4547,7 @@ std::string YulUtilFunctions::readFromMemoryOrCalldata(Type const& _type, bool _
 std::string YulUtilFunctions::revertReasonIfDebugFunction(std::string const& _message)
 {
 	std::string functionName = "revert_error_" + util::toHex(util::keccak256(_message).asBytes());
-	return m_functionCollector.createFunction(functionName, [&](auto&, auto&) -> std::string {
+	return m_functionCollector.createReusableFunction(functionName, [&](auto&, auto&) -> std::string {
 		return revertReasonIfDebugBody(m_revertStrings, allocateUnboundedFunction() + "()", _message);
 	});
 }
@@ -4593,7 +4595,7 @@ std::string YulUtilFunctions::revertReasonIfDebugBody(
 std::string YulUtilFunctions::panicFunction(util::PanicCode _code)
 {
 	std::string functionName = "panic_error_" + toCompactHexWithPrefix(uint64_t(_code));
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>() {
 				mstore(0, <selector>)
@@ -4613,7 +4615,7 @@ std::string YulUtilFunctions::returnDataSelectorFunction()
 	std::string const functionName = "return_data_selector";
 	solAssert(m_evmVersion.supportsReturndata(), "");
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return util::Whiskers(R"(
 			function <functionName>() -> sig {
 				if gt(returndatasize(), 3) {
@@ -4633,7 +4635,7 @@ std::string YulUtilFunctions::tryDecodeErrorMessageFunction()
 	std::string const functionName = "try_decode_error_message";
 	solAssert(m_evmVersion.supportsReturndata(), "");
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return util::Whiskers(R"(
 			function <functionName>() -> ret {
 				if lt(returndatasize(), 0x44) { leave }
@@ -4672,7 +4674,7 @@ std::string YulUtilFunctions::tryDecodePanicDataFunction()
 	std::string const functionName = "try_decode_panic_data";
 	solAssert(m_evmVersion.supportsReturndata(), "");
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return util::Whiskers(R"(
 			function <functionName>() -> success, data {
 				if gt(returndatasize(), 0x23) {
@@ -4691,7 +4693,7 @@ std::string YulUtilFunctions::extractReturndataFunction()
 {
 	std::string const functionName = "extract_returndata";
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return util::Whiskers(R"(
 			function <functionName>() -> data {
 				<?supportsReturndata>
@@ -4763,7 +4765,7 @@ std::string YulUtilFunctions::externalCodeFunction()
 {
 	std::string functionName = "external_code_at";
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return util::Whiskers(R"(
 			function <functionName>(addr) -> mpos {
 				let length := extcodesize(addr)
@@ -4780,7 +4782,7 @@ std::string YulUtilFunctions::externalCodeFunction()
 std::string YulUtilFunctions::externalFunctionPointersEqualFunction()
 {
 	std::string const functionName = "externalFunctionPointersEqualFunction";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createReusableFunction(functionName, [&]() {
 		return util::Whiskers(R"(
 			function <functionName>(
 				leftAddress,
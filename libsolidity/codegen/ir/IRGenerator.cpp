@@ -1168,7 +1168,8 @@ void IRGenerator::resetContext(ContractDefinition const& _contract, ExecutionCon
 		m_context.revertStrings(),
 		m_context.sourceIndices(),
 		m_context.debugInfoSelection(),
-		m_context.soliditySourceProvider()
+		m_context.soliditySourceProvider(),
+		m_functionCache
 	);
 
 	m_context = std::move(newContext);
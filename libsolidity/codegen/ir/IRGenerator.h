@@ -53,10 +53,12 @@ public:
 		std::map<std::string, unsigned> _sourceIndices,
 		langutil::DebugInfoSelection const& _debugInfoSelection,
 		langutil::CharStreamProvider const* _soliditySourceProvider,
-		OptimiserSettings& _optimiserSettings
+		OptimiserSettings& _optimiserSettings,
+		MultiUseYulFunctionCache* _functionCache = nullptr
 	):
 		m_evmVersion(_evmVersion),
 		m_eofVersion(_eofVersion),
+		m_functionCache(_functionCache),
 		m_context(
 			_evmVersion,
 			_eofVersion,
@@ -64,7 +66,8 @@ public:
 			_revertStrings,
 			std::move(_sourceIndices),
 			_debugInfoSelection,
-			_soliditySourceProvider
+			_soliditySourceProvider,
+			_functionCache
 		),
 		m_utils(_evmVersion, _eofVersion, m_context.revertStrings(), m_context.functionCollector()),
 		m_optimiserSettings(_optimiserSettings)
@@ -142,6 +145,8 @@ private:
 
 	langutil::EVMVersion const m_evmVersion;
 	std::optional<uint8_t> const m_eofVersion;
+	/// Cache of contract-independent utility functions shared with other contracts. Can be nullptr.
+	MultiUseYulFunctionCache* const m_functionCache;
 
 	IRGenerationContext m_context;
 	YulUtilFunctions m_utils;
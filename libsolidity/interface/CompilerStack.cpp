@@ -109,9 +109,9 @@ using solidity::util::errinfo_comment;
 
 static int g_compilerStackCounts = 0;
 
-CompilerStack::CompilerStack(ReadCallback::Callback _readFile):
+CompilerStack::CompilerStack(ReadCallback::Callback _readFile, std::shared_ptr<yul::ObjectOptimizer> _objectOptimizer):
 	m_readFile{std::move(_readFile)},
-	m_objectOptimizer(std::make_shared<yul::ObjectOptimizer>()),
+	m_objectOptimizer(_objectOptimizer ? std::move(_objectOptimizer) : std::make_shared<yul::ObjectOptimizer>()),
 	m_errorReporter{m_errorList}
 {
 	// Because TypeProvider is currently a singleton API, we must ensure that
@@ -334,6 +334,7 @@ void CompilerStack::reset(bool _keepSettings)
 	m_globalContext.reset();
 	m_sourceOrder.clear();
 	m_contracts.clear();
+	m_yulFunctionCache.clear();
 	m_errorReporter.clear();
 	TypeProvider::reset();
 }
@@ -342,8 +343,8 @@ void CompilerStack::setSources(StringMap _sources)
 {
 	solAssert(m_stackState != SourcesSet, "Cannot change sources once set.");
 	solAssert(m_stackState == Empty, "Must set sources before parsing.");
-	for (auto source: _sources)
-		m_sources[source.first].charStream = std::make_unique<CharStream>(/*content*/std::move(source.second), /*name*/source.first);
+	for (auto& [sourceName, content]: _sources)
+		m_sources[sourceName].charStream = std::make_unique<CharStream>(/*content*/std::move(content), /*name*/sourceName);
 	m_stackState = SourcesSet;
 }
 
@@ -397,11 +398,9 @@ bool CompilerStack::parse()
 				}
 
 				if (m_stopAfter >= ParsedAndImported)
-					for (auto const& newSource: loadMissingSources(*source.ast))
+					for (auto&& [newPath, newContents]: loadMissingSources(*source.ast))
 					{
-						std::string const& newPath = newSource.first;
-						std::string const& newContents = newSource.second;
-						m_sources[newPath].charStream = std::make_shared<CharStream>(newContents, newPath);
+						m_sources[newPath].charStream = std::make_shared<CharStream>(std::move(newContents), newPath);
 						sourcesToParse.push_back(newPath);
 					}
 			}
@@ -1304,7 +1303,7 @@ StringMap CompilerStack::loadMissingSources(SourceUnit const& _ast)
 					result = m_readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), importPath);
 
 				if (result.success)
-					newSources[importPath] = result.responseOrErrorMessage;
+					newSources[importPath] = std::move(result.responseOrErrorMessage);
 				else
 				{
 					m_errorReporter.parserError(
@@ -1611,7 +1610,8 @@ void CompilerStack::generateIR(ContractDefinition const& _contract, bool _unopti
 			sourceIndices(),
 			m_debugInfoSelection,
 			this,
-			m_optimiserSettings
+			m_optimiserSettings,
+			&m_yulFunctionCache
 		);
 		compiledContract.yulIR = generator.run(
 			_contract,
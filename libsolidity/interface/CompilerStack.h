@@ -25,6 +25,7 @@
 #pragma once
 
 #include <libsolidity/analysis/FunctionCallGraph.h>
+#include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolidity/interface/ImportRemapper.h>
 #include <libsolidity/interface/OptimiserSettings.h>
@@ -184,7 +185,12 @@ public:
 	/// Creates a new compiler stack.
 	/// @param _readFile callback used to read files for import statements. Must return
 	/// and must not emit exceptions.
-	explicit CompilerStack(ReadCallback::Callback _readFile = ReadCallback::Callback());
+	/// @param _objectOptimizer cache of optimized Yul objects, which may be shared with other
+	/// compilations. A new one is created if not given.
+	explicit CompilerStack(
+		ReadCallback::Callback _readFile = ReadCallback::Callback(),
+		std::shared_ptr<yul::ObjectOptimizer> _objectOptimizer = nullptr
+	);
 
 	~CompilerStack() override;
 
@@ -620,6 +626,8 @@ private:
 	std::shared_ptr<GlobalContext> m_globalContext;
 	std::vector<Source const*> m_sourceOrder;
 	std::map<std::string const, Contract> m_contracts;
+	/// Yul utility functions generated for one contract that can be reused for the IR of other contracts.
+	MultiUseYulFunctionCache m_yulFunctionCache;
 	std::shared_ptr<yul::ObjectOptimizer> m_objectOptimizer;
 
 	langutil::ErrorList m_errorList;
@@ -159,9 +159,8 @@ ReadCallback::Result FileReader::readFile(std::string const& _kind, std::string
 			return ReadCallback::Result{false, "Not a valid file."};
 
 		// NOTE: we ignore the FileNotFound exception as we manually check above
-		auto contents = readFileAsString(candidates[0]);
 		solAssert(m_sourceCodes.count(_sourceUnitName) == 0, "");
-		m_sourceCodes[_sourceUnitName] = contents;
+		std::string const& contents = m_sourceCodes[_sourceUnitName] = readFileAsString(candidates[0]);
 		return ReadCallback::Result{true, contents};
 	}
 	catch (...)
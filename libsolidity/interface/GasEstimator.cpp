@@ -47,6 +47,10 @@ GasEstimator::GasConsumption GasEstimator::functionalEstimation(
 	std::string const& _signature
 ) const
 {
+	auto const cacheKey = std::make_pair(&_items, _signature);
+	if (auto cachedGas = m_signatureEstimates.find(cacheKey); cachedGas != m_signatureEstimates.end())
+		return cachedGas->second;
+
 	auto state = std::make_shared<KnownState>();
 
 	if (!_signature.empty())
@@ -78,7 +82,7 @@ GasEstimator::GasConsumption GasEstimator::functionalEstimation(
 		);
 	}
 
-	return PathGasMeter::estimateMax(_items, m_evmVersion, 0, state);
+	return m_signatureEstimates[cacheKey] = pathGasMeter(_items).estimateMax(0, state);
 }
 
 GasEstimator::GasConsumption GasEstimator::functionalEstimation(
@@ -87,12 +91,18 @@ GasEstimator::GasConsumption GasEstimator::functionalEstimation(
 	FunctionDefinition const& _function
 ) const
 {
-	auto state = std::make_shared<KnownState>();
-
 	unsigned parametersSize = CompilerUtils::sizeOnStack(_function.parameters());
 	if (parametersSize > 16)
 		return GasConsumption::infinite();
 
+	// The estimate only depends on the entry point and the number of stack slots of the parameters,
+	// so functions sharing both, e.g. after their code was deduplicated, share it as well.
+	auto const cacheKey = std::make_tuple(&_items, _offset, parametersSize);
+	if (auto cachedGas = m_functionEstimates.find(cacheKey); cachedGas != m_functionEstimates.end())
+		return cachedGas->second;
+
+	auto state = std::make_shared<KnownState>();
+
 	// Store an invalid return value on the stack, so that the path estimator breaks upon reaching
 	// the return jump.
 	AssemblyItem invalidTag(PushTag, u256(-0x10));
@@ -100,7 +110,15 @@ GasEstimator::GasConsumption GasEstimator::functionalEstimation(
 	if (parametersSize > 0)
 		state->feedItem(swapInstruction(parametersSize));
 
-	return PathGasMeter::estimateMax(_items, m_evmVersion, _offset, state);
+	return m_functionEstimates[cacheKey] = pathGasMeter(_items).estimateMax(_offset, state);
+}
+
+PathGasMeter& GasEstimator::pathGasMeter(AssemblyItems const& _items) const
+{
+	std::unique_ptr<PathGasMeter>& meter = m_pathGasMeters[&_items];
+	if (!meter)
+		meter = std::make_unique<PathGasMeter>(_items, m_evmVersion);
+	return *meter;
 }
 
 std::set<ASTNode const*> GasEstimator::finestNodesAtLocation(
@@ -27,9 +27,14 @@
 
 #include <libevmasm/Assembly.h>
 #include <libevmasm/GasMeter.h>
+#include <libevmasm/PathGasMeter.h>
 
 #include <array>
 #include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace solidity::frontend
@@ -65,9 +70,16 @@ public:
 	) const;
 
 private:
+	/// @returns the path gas meter for @a _items, which is shared by all estimates on the same items.
+	evmasm::PathGasMeter& pathGasMeter(evmasm::AssemblyItems const& _items) const;
 	/// @returns the set of AST nodes which are the finest nodes at their location.
 	static std::set<ASTNode const*> finestNodesAtLocation(std::vector<ASTNode const*> const& _roots);
 	langutil::EVMVersion m_evmVersion;
+	mutable std::map<evmasm::AssemblyItems const*, std::unique_ptr<evmasm::PathGasMeter>> m_pathGasMeters;
+	/// Results of previous estimates by items and signature.
+	mutable std::map<std::pair<evmasm::AssemblyItems const*, std::string>, GasConsumption> m_signatureEstimates;
+	/// Results of previous estimates by items, entry point and number of stack slots of the parameters.
+	mutable std::map<std::tuple<evmasm::AssemblyItems const*, size_t, unsigned>, GasConsumption> m_functionEstimates;
 };
 
 }
@@ -125,7 +125,8 @@ struct OptimiserSettings
 			optimizeStackAllocation == _other.optimizeStackAllocation &&
 			runYulOptimiser == _other.runYulOptimiser &&
 			yulOptimiserSteps == _other.yulOptimiserSteps &&
-			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment;
+			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment &&
+			maxThreads == _other.maxThreads;
 	}
 
 	bool operator!=(OptimiserSettings const& _other) const
@@ -167,6 +168,11 @@ struct OptimiserSettings
 	/// This specifies an estimate on how often each opcode in this assembly will be executed,
 	/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 	size_t expectedExecutionsPerDeployment = 200;
+	/// Maximum number of threads used to optimise sub-assemblies and to generate stack layouts,
+	/// including the calling thread.
+	/// Zero means one per hardware thread and 1 does all the work on the calling thread.
+	/// The generated code does not depend on this setting.
+	size_t maxThreads = 0;
 };
 
 }
@@ -44,6 +44,7 @@
 
 #include <algorithm>
 #include <optional>
+#include <sstream>
 
 using namespace solidity;
 using namespace solidity::yul;
@@ -648,7 +649,9 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 
 	ret.language = _input.value<std::string>("language", "");
 
-	Json const& sources = _input.value<Json>("sources", Json());
+	// Refer to the sources in place instead of copying them out of the input.
+	Json const noSources;
+	Json const& sources = _input.contains("sources") ? _input["sources"] : noSources;
 
 	if (!sources.is_object() && !sources.is_null())
 		return formatFatalError(Error::Type::JSONError, "\"sources\" is not a JSON object.");
@@ -673,7 +676,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 
 			if (sourceValue.contains("content") && sourceValue["content"].is_string())
 			{
-				std::string content = sourceValue["content"].get<std::string>();
+				std::string const& content = sourceValue["content"].get_ref<std::string const&>();
 				if (!hash.empty() && !hashMatchesContent(hash, content))
 					ret.errors.emplace_back(formatError(
 						Error::Type::IOError,
@@ -708,7 +711,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 							));
 						else
 						{
-							ret.sources[sourceName] = result.responseOrErrorMessage;
+							ret.sources[sourceName] = std::move(result.responseOrErrorMessage);
 							found = true;
 							break;
 						}
@@ -1346,15 +1349,29 @@ Json StandardCompiler::importEVMAssembly(StandardCompiler::InputsAndSettings _in
 	return util::removeNullMembers(output);
 }
 
-Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings)
+Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings, util::JsonStreamWriter* _writer)
 {
 	solAssert(_inputsAndSettings.jsonSources.empty());
 
-	CompilerStack compilerStack(m_readFile);
+	CompilerStack compilerStack(m_readFile, m_objectOptimizer);
 
 	StringMap sourceList = std::move(_inputsAndSettings.sources);
+	std::vector<std::string> inputSourceNames;
 	if (_inputsAndSettings.language == "Solidity")
-		compilerStack.setSources(sourceList);
+	{
+		for (auto const& source: sourceList)
+			inputSourceNames.push_back(source.first);
+		compilerStack.setSources(std::move(sourceList));
+		sourceList.clear();
+	}
+	// The compiler stack owns the contents of Solidity sources. They are only copied back
+	// if the assembly output, which quotes them, is requested.
+	auto assemblySourceCodes = [&]() -> StringMap const& {
+		if (sourceList.empty())
+			for (std::string const& sourceName: inputSourceNames)
+				sourceList[sourceName] = compilerStack.charStream(sourceName).source();
+		return sourceList;
+	};
 	for (auto const& smtLib2Response: _inputsAndSettings.smtLib2Responses)
 		compilerStack.addSMTLib2Response(smtLib2Response.first, smtLib2Response.second);
 	compilerStack.setViaIR(_inputsAndSettings.viaIR);
@@ -1477,37 +1494,44 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 		solAssert(!errors.empty(), "No error reported, but compilation failed.");
 
 	Json output;
-
-	if (errors.size() > 0)
-		output["errors"] = std::move(errors);
+	// Without a writer, the members are collected in the returned object.
+	// With a writer, they are serialised right away, which requires writing them in key order.
+	auto addToOutput = [&](std::vector<std::string> const& _path, Json _value) {
+		if (_writer)
+			_writer->write(_path, _value);
+		else
+		{
+			Json* member = &output;
+			for (std::string const& key: _path)
+				member = &(*member)[key];
+			*member = std::move(_value);
+		}
+	};
 
 	if (!compilerStack.unhandledSMTLib2Queries().empty())
+	{
+		Json auxiliaryInputRequested;
 		for (std::string const& query: compilerStack.unhandledSMTLib2Queries())
-			output["auxiliaryInputRequested"]["smtlib2queries"]["0x" + util::keccak256(query).hex()] = query;
+			auxiliaryInputRequested["smtlib2queries"]["0x" + util::keccak256(query).hex()] = query;
+		addToOutput({"auxiliaryInputRequested"}, std::move(auxiliaryInputRequested));
+	}
 
 	bool const wildcardMatchesExperimental = false;
 
-	output["sources"] = Json::object();
-	unsigned sourceIndex = 0;
-	// NOTE: A case that will pass `parsingSuccess && !analysisFailed` but not `analysisSuccess` is
-	// stopAfter: parsing with no parsing errors.
-	if (parsingSuccess && !analysisFailed)
-		for (std::string const& sourceName: compilerStack.sourceNames())
-		{
-			Json sourceResult;
-			sourceResult["id"] = sourceIndex++;
-			if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "ast", wildcardMatchesExperimental))
-				sourceResult["ast"] = ASTJsonExporter(compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
-			output["sources"][sourceName] = sourceResult;
-		}
-
-	Json contractsOutput;
+	// Contracts are output grouped by source unit, which does not necessarily match the order of
+	// their fully qualified names.
+	std::vector<std::pair<std::string, std::string>> contracts;
 	for (std::string const& contractName: analysisSuccess ? compilerStack.contractNames() : std::vector<std::string>())
 	{
 		size_t colon = contractName.rfind(':');
 		solAssert(colon != std::string::npos, "");
-		std::string file = contractName.substr(0, colon);
-		std::string name = contractName.substr(colon + 1);
+		contracts.emplace_back(contractName.substr(0, colon), contractName.substr(colon + 1));
+	}
+	std::sort(contracts.begin(), contracts.end());
+
+	for (auto const& [file, name]: contracts)
+	{
+		std::string const contractName = file + ":" + name;
 
 		// ABI, storage layout, documentation and metadata
 		Json contractData;
@@ -1539,7 +1563,7 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 		// EVM
 		Json evmData;
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.assembly", wildcardMatchesExperimental))
-			evmData["assembly"] = compilerStack.assemblyString(contractName, sourceList);
+			evmData["assembly"] = compilerStack.assemblyString(contractName, assemblySourceCodes());
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.legacyAssembly", wildcardMatchesExperimental))
 			evmData["legacyAssembly"] = compilerStack.assemblyJSON(contractName);
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.methodIdentifiers", wildcardMatchesExperimental))
@@ -1613,18 +1637,31 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 			contractData["evm"] = evmData;
 
 		if (!contractData.empty())
-		{
-			if (!contractsOutput.contains(file))
-				contractsOutput[file] = Json::object();
-			contractsOutput[file][name] = contractData;
-		}
+			addToOutput({"contracts", file, name}, std::move(contractData));
 	}
 
+	if (errors.size() > 0)
+		addToOutput({"errors"}, std::move(errors));
+
 	if (isEthdebugRequested(_inputsAndSettings.outputSelection))
-		output["ethdebug"] = compilerStack.ethdebug();
+		addToOutput({"ethdebug"}, compilerStack.ethdebug());
 
-	if (!contractsOutput.empty())
-		output["contracts"] = contractsOutput;
+	// NOTE: A case that will pass `parsingSuccess && !analysisFailed` but not `analysisSuccess` is
+	// stopAfter: parsing with no parsing errors.
+	std::vector<std::string> sourceNames;
+	if (parsingSuccess && !analysisFailed)
+		sourceNames = compilerStack.sourceNames();
+	if (sourceNames.empty())
+		addToOutput({"sources"}, Json::object());
+	unsigned sourceIndex = 0;
+	for (std::string const& sourceName: sourceNames)
+	{
+		Json sourceResult;
+		sourceResult["id"] = sourceIndex++;
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "ast", wildcardMatchesExperimental))
+			sourceResult["ast"] = ASTJsonExporter(compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
+		addToOutput({"sources", sourceName}, std::move(sourceResult));
+	}
 
 	return output;
 }
@@ -1694,7 +1731,9 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 		_inputsAndSettings.optimiserSettings,
 		_inputsAndSettings.debugInfoSelection.has_value() ?
 			_inputsAndSettings.debugInfoSelection.value() :
-			DebugInfoSelection::Default()
+			DebugInfoSelection::Default(),
+		nullptr /* _soliditySourceProvider */,
+		m_objectOptimizer
 	);
 	std::string const& sourceName = _inputsAndSettings.sources.begin()->first;
 	std::string const& sourceContents = _inputsAndSettings.sources.begin()->second;
@@ -1800,7 +1839,13 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 
 Json StandardCompiler::compile(Json const& _input) noexcept
 {
-	YulStringRepository::reset();
+	return compile(_input, nullptr);
+}
+
+Json StandardCompiler::compile(Json const& _input, util::JsonStreamWriter* _writer) noexcept
+{
+	if (!m_reuseOptimizedObjects || YulStringRepository::instance().size() > m_maxYulStrings)
+		YulStringRepository::reset();
 
 	try
 	{
@@ -1809,11 +1854,11 @@ Json StandardCompiler::compile(Json const& _input) noexcept
 			return std::get<Json>(std::move(parsed));
 		InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
 		if (settings.language == "Solidity")
-			return compileSolidity(std::move(settings));
+			return compileSolidity(std::move(settings), _writer);
 		else if (settings.language == "Yul")
 			return compileYul(std::move(settings));
 		else if (settings.language == "SolidityAST")
-			return compileSolidity(std::move(settings));
+			return compileSolidity(std::move(settings), _writer);
 		else if (settings.language == "EVMAssembly")
 			return importEVMAssembly(std::move(settings));
 		else
@@ -1831,34 +1876,71 @@ Json StandardCompiler::compile(Json const& _input) noexcept
 }
 
 std::string StandardCompiler::compile(std::string const& _input) noexcept
+{
+	std::ostringstream output;
+	compile(_input, output);
+	return std::move(output).str();
+}
+
+void StandardCompiler::compile(std::string const& _input, std::ostream& _output) noexcept
 {
 	Json input;
 	std::string errors;
 	try
 	{
 		if (!util::jsonParseStrict(_input, input, &errors))
-			return util::jsonPrint(formatFatalError(Error::Type::JSONError, errors), m_jsonPrintingFormat);
+		{
+			_output << util::jsonPrint(formatFatalError(Error::Type::JSONError, errors), m_jsonPrintingFormat);
+			return;
+		}
 	}
 	catch (...)
 	{
 		if (errors.empty())
-			return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
+			_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
 		else
-			return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON: " + errors + "\"}]}";
+			_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON: " + errors + "\"}]}";
+		return;
 	}
 
 //	std::cout << "Input: " << solidity::util::jsonPrettyPrint(input) << std::endl;
-	Json output = compile(input);
-//	std::cout << "Output: " << solidity::util::jsonPrettyPrint(output) << std::endl;
+	// The Solidity output is written to the stream as it is produced instead of being built as a whole first.
+	util::JsonStreamWriter writer(_output, m_jsonPrintingFormat);
+	Json output = compile(input, &writer);
 
 	try
 	{
-		return util::jsonPrint(output, m_jsonPrintingFormat);
+		if (output.is_null() || writer.empty())
+		{
+			// Outputs other than the Solidity one, as well as errors reported before anything was
+			// written, are returned as a whole.
+			if (!output.is_null())
+				for (auto const& [key, value]: output.items())
+					writer.write({key}, value);
+			if (!writer.failed())
+			{
+				writer.finish();
+				return;
+			}
+		}
+		else
+		{
+			// A fatal error that occurs after parts of the output were written cannot replace the whole
+			// output anymore. It is reported as a trailing "errors" member instead, which takes precedence
+			// over the one written before for the usual JSON parsers.
+			writer.finish("errors", output["errors"]);
+			return;
+		}
 	}
 	catch (...)
 	{
-		return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
 	}
+	writer.finish("errors", Json::array({{
+		{"type", "JSONError"},
+		{"component", "general"},
+		{"severity", "error"},
+		{"message", "Error writing output JSON."}
+	}}));
 }
 
 Json StandardCompiler::formatFunctionDebugData(
@@ -29,6 +29,7 @@
 #include <liblangutil/DebugInfoSelection.h>
 
 #include <optional>
+#include <ostream>
 #include <utility>
 #include <variant>
 
@@ -62,6 +63,24 @@ public:
 	/// Parses input as JSON and performs the above processing steps, returning a serialized JSON
 	/// output. Parsing errors are returned as regular errors.
 	std::string compile(std::string const& _input) noexcept;
+	/// Same as above, but writes the serialized output to @a _output while it is produced.
+	/// A fatal error that occurs after parts of the output were written is reported in an
+	/// additional "errors" member at the end of the output.
+	void compile(std::string const& _input, std::ostream& _output) noexcept;
+
+	/// Replaces the callback used to read files in subsequent calls to compile().
+	void setReadCallback(ReadCallback::Callback _readFile) { m_readFile = std::move(_readFile); }
+
+	/// If enabled, optimized Yul objects are kept across calls to compile(), so that long-running
+	/// processes compiling similar inputs repeatedly only optimize the objects that changed.
+	/// The cached objects refer to YulStrings, so the YulStringRepository is then only reset
+	/// at the beginning of a compilation once it holds more than @a _maxYulStrings strings,
+	/// which also discards the cached objects.
+	void setReuseOptimizedObjects(bool _reuse, size_t _maxYulStrings = defaultMaxYulStrings)
+	{
+		m_reuseOptimizedObjects = _reuse;
+		m_maxYulStrings = _maxYulStrings;
+	}
 
 	static Json formatFunctionDebugData(
 		std::map<std::string, evmasm::LinkerObject::FunctionDebugData> const& _debugInfo
@@ -96,13 +115,24 @@ private:
 	std::variant<InputsAndSettings, Json> parseInput(Json const& _input);
 
 	std::map<std::string, Json> parseAstFromInput(StringMap const& _sources);
+	/// Performs the processing steps of compile() on the parsed input @a _input.
+	/// If @a _writer is given, the output of a successful Solidity compilation is written to it
+	/// and null is returned instead. Errors that prevent any output are always returned.
+	Json compile(Json const& _input, util::JsonStreamWriter* _writer) noexcept;
+
 	Json importEVMAssembly(InputsAndSettings _inputsAndSettings);
-	Json compileSolidity(InputsAndSettings _inputsAndSettings);
+	Json compileSolidity(InputsAndSettings _inputsAndSettings, util::JsonStreamWriter* _writer = nullptr);
 	Json compileYul(InputsAndSettings _inputsAndSettings);
 
 	ReadCallback::Callback m_readFile;
 
 	util::JsonFormat m_jsonPrintingFormat;
+
+	static size_t constexpr defaultMaxYulStrings = 1000000;
+	bool m_reuseOptimizedObjects = false;
+	size_t m_maxYulStrings = defaultMaxYulStrings;
+	/// Cache of optimized Yul objects, shared by all compilations of this instance.
+	std::shared_ptr<yul::ObjectOptimizer> m_objectOptimizer = std::make_shared<yul::ObjectOptimizer>();
 };
 
 }
@@ -0,0 +1,75 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace solidity::util
+{
+
+/**
+ * A value that is shared between copies until one of them is modified. Copying is constant time,
+ * the first modification through a copy that shares the value with others copies the value.
+ * A default-constructed instance holds a default-constructed value without allocating it.
+ *
+ * Copies must not be modified concurrently from different threads.
+ *
+ * @tparam T the type of the stored value; must be default-constructible and copy-constructible.
+ */
+template<typename T>
+class CopyOnWrite
+{
+public:
+	using value_type = T;
+
+	static_assert(std::is_object_v<value_type> && !std::is_const_v<value_type>, "Only non-const object types are supported.");
+
+	CopyOnWrite() = default;
+	explicit CopyOnWrite(value_type _value): m_value(std::make_shared<value_type>(std::move(_value))) {}
+
+	value_type const& operator*() const { return m_value ? *m_value : empty(); }
+	value_type const* operator->() const { return &**this; }
+
+	/// @returns a reference to the value that can be modified without affecting any copies.
+	/// The reference is invalidated by copying this object.
+	value_type& mutate()
+	{
+		if (!m_value)
+			m_value = std::make_shared<value_type>();
+		else if (m_value.use_count() > 1)
+			m_value = std::make_shared<value_type>(*m_value);
+		return *m_value;
+	}
+
+	/// Replaces the value by a default-constructed one without copying it first.
+	void reset() { m_value.reset(); }
+
+private:
+	static value_type const& empty()
+	{
+		static value_type const emptyValue{};
+		return emptyValue;
+	}
+
+	std::shared_ptr<value_type> m_value;
+};
+
+}
@@ -152,7 +152,7 @@ bytes groupChunksBottomUp(Chunks _currentLevel)
 }
 }
 
-bytes solidity::util::ipfsHash(std::string _data)
+bytes solidity::util::ipfsHash(std::string const& _data)
 {
 	size_t const maxChunkSize = 1024 * 256;
 	size_t chunkCount = _data.length() / maxChunkSize + (_data.length() % maxChunkSize > 0 ? 1 : 0);
@@ -162,41 +162,46 @@ bytes solidity::util::ipfsHash(std::string _data)
 
 	for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
 	{
-		bytes chunkBytes = asBytes(
-			_data.substr(chunkIndex * maxChunkSize, std::min(maxChunkSize, _data.length() - chunkIndex * maxChunkSize))
-		);
-
-		bytes lengthAsVarint = varintEncoding(chunkBytes.size());
-
-		bytes protobufEncodedData;
+		size_t const chunkBegin = chunkIndex * maxChunkSize;
+		size_t const chunkSize = std::min(maxChunkSize, _data.length() - chunkBegin);
+		bytes lengthAsVarint = varintEncoding(chunkSize);
+
+		// The block is the chunk data wrapped into a UnixFS protobuf message, which is in turn wrapped
+		// into a PBDag message. Only the encoding around the data is built here, the data itself is
+		// hashed in place.
+		bytes protobufPrefix;
 		// Type: File
-		protobufEncodedData += bytes{0x08, 0x02};
-		if (!chunkBytes.empty())
-		{
+		protobufPrefix += bytes{0x08, 0x02};
+		if (chunkSize > 0)
 			// Data (length delimited bytes)
-			protobufEncodedData += bytes{0x12};
-			protobufEncodedData += lengthAsVarint;
-			protobufEncodedData += chunkBytes;
-		}
+			protobufPrefix += bytes{0x12} + lengthAsVarint;
 		// filesize: length as varint
-		protobufEncodedData += bytes{0x18} + lengthAsVarint;
+		bytes protobufSuffix = bytes{0x18} + lengthAsVarint;
 
 		// PBDag:
 		// Data: (length delimited bytes)
-		bytes blockData = encodeByteArray(protobufEncodedData);
+		bytes blockPrefix = bytes{0x0a} + varintEncoding(protobufPrefix.size() + chunkSize + protobufSuffix.size()) + protobufPrefix;
 
 		// Multihash: sha2-256, 256 bits
+		picosha2::hash256_one_by_one hasher;
+		hasher.process(blockPrefix.begin(), blockPrefix.end());
+		hasher.process(_data.begin() + static_cast<std::ptrdiff_t>(chunkBegin), _data.begin() + static_cast<std::ptrdiff_t>(chunkBegin + chunkSize));
+		hasher.process(protobufSuffix.begin(), protobufSuffix.end());
+		hasher.finish();
+		bytes hash(picosha2::k_digest_size);
+		hasher.get_hash_bytes(hash.begin(), hash.end());
+
 		allChunks.emplace_back(
-			encodeHash(blockData),
-			chunkBytes.size(),
-			blockData.size()
+			bytes{0x12, 0x20} + hash,
+			chunkSize,
+			blockPrefix.size() + chunkSize + protobufSuffix.size()
 		);
 	}
 
 	return groupChunksBottomUp(std::move(allChunks));
 }
 
-std::string solidity::util::ipfsHashBase58(std::string _data)
+std::string solidity::util::ipfsHashBase58(std::string const& _data)
 {
-	return base58Encode(ipfsHash(std::move(_data)));
+	return base58Encode(ipfsHash(_data));
 }
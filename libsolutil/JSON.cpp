@@ -138,6 +138,108 @@ std::string jsonPrint(Json const& _input, JsonFormat const& _format)
 	return dumped;
 }
 
+JsonStreamWriter::JsonStreamWriter(std::ostream& _out, JsonFormat const& _format):
+	m_out(_out),
+	m_format(_format),
+	m_lastKeys(1)
+{
+	m_out << "{";
+}
+
+void JsonStreamWriter::write(std::vector<std::string> const& _path, Json const& _value)
+{
+	assertThrow(!_path.empty(), Exception, "");
+	assertThrow(!m_lastKeys.empty(), Exception, "Writing to a finished JSON document.");
+	if (m_failed)
+		return;
+
+	std::string serialisedValue;
+	try
+	{
+		serialisedValue = jsonPrint(_value, m_format);
+	}
+	catch (Json::exception const&)
+	{
+		m_failed = true;
+		return;
+	}
+
+	size_t commonPrefix = 0;
+	while (
+		commonPrefix < m_openObjects.size() &&
+		commonPrefix + 1 < _path.size() &&
+		m_openObjects[commonPrefix] == _path[commonPrefix]
+	)
+		++commonPrefix;
+	while (m_openObjects.size() > commonPrefix)
+		closeObject();
+	for (size_t i = commonPrefix; i + 1 < _path.size(); ++i)
+	{
+		beginMember(_path[i]);
+		m_out << "{";
+		m_openObjects.emplace_back(_path[i]);
+		m_lastKeys.emplace_back();
+	}
+
+	beginMember(_path.back());
+	writeValue(std::move(serialisedValue));
+}
+
+void JsonStreamWriter::finish()
+{
+	assertThrow(!m_lastKeys.empty(), Exception, "JSON document already finished.");
+	while (!m_openObjects.empty())
+		closeObject();
+	closeObject();
+}
+
+void JsonStreamWriter::finish(std::string const& _key, Json const& _value)
+{
+	assertThrow(!m_lastKeys.empty(), Exception, "JSON document already finished.");
+	std::string serialisedValue = jsonPrint(_value, m_format);
+	while (!m_openObjects.empty())
+		closeObject();
+	beginMember(_key, false);
+	writeValue(std::move(serialisedValue));
+	closeObject();
+}
+
+void JsonStreamWriter::beginMember(std::string const& _key, bool _checkOrder)
+{
+	std::optional<std::string>& lastKey = m_lastKeys.back();
+	// This also rejects reopening an object that was already closed.
+	if (_checkOrder)
+		assertThrow(!lastKey || *lastKey < _key, Exception, "JSON members have to be written in order.");
+	if (lastKey)
+		m_out << ",";
+	if (m_format.format == JsonFormat::Pretty)
+		m_out << newLine(m_openObjects.size() + 1);
+	m_out << jsonPrint(Json(_key), m_format) << (m_format.format == JsonFormat::Pretty ? ": " : ":");
+	lastKey = _key;
+}
+
+void JsonStreamWriter::writeValue(std::string _serialisedValue)
+{
+	if (m_format.format == JsonFormat::Pretty)
+		boost::replace_all(_serialisedValue, "\n", newLine(m_openObjects.size() + 1));
+	m_out << _serialisedValue;
+}
+
+void JsonStreamWriter::closeObject()
+{
+	if (m_lastKeys.back() && m_format.format == JsonFormat::Pretty)
+		m_out << newLine(m_openObjects.size());
+	m_out << "}";
+	m_lastKeys.pop_back();
+	if (!m_openObjects.empty())
+		m_openObjects.pop_back();
+}
+
+std::string JsonStreamWriter::newLine(size_t _depth) const
+{
+	return "\n" + std::string(_depth * m_format.indent, ' ');
+}
+
 bool jsonParseStrict(std::string const& _input, Json& _json, std::string* _errs /* = nullptr */)
 {
 	try
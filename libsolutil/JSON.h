@@ -26,10 +26,12 @@
 #include <libsolutil/Assertions.h>
 #include <nlohmann/json.hpp>
 
+#include <ostream>
 #include <string>
 #include <string_view>
 #include <optional>
 #include <limits>
+#include <vector>
 
 namespace solidity
 {
@@ -71,6 +73,51 @@ std::string jsonCompactPrint(Json const& _input);
 /// Serialise the JSON object (@a _input) using specified format (@a _format)
 std::string jsonPrint(Json const& _input, JsonFormat const& _format);
 
+/// Writes a JSON object to a stream member by member, without building the whole document in memory.
+/// The result is the same text jsonPrint() produces for the complete object, provided that the members
+/// are written in the order in which they appear in the document, i.e. sorted by key at every level.
+class JsonStreamWriter
+{
+public:
+	JsonStreamWriter(std::ostream& _out, JsonFormat const& _format);
+
+	/// Writes @a _value as the member at the key path @a _path (e.g. {"contracts", "a.sol", "C"}),
+	/// opening and closing the enclosing objects as needed.
+	/// If @a _value cannot be serialised (e.g. because it contains invalid UTF-8), nothing is written
+	/// and the writer fails.
+	void write(std::vector<std::string> const& _path, Json const& _value);
+	/// Closes all open objects including the document itself. Nothing can be written afterwards.
+	void finish();
+	/// Closes all open objects and writes @a _value as the last member @a _key of the document
+	/// before closing it, regardless of the key order and of whether @a _key was written before.
+	/// Meant for reporting errors that occur after parts of the document were already written.
+	/// Throws if @a _value cannot be serialised, in which case nothing is written.
+	void finish(std::string const& _key, Json const& _value);
+
+	/// @returns true if nothing was written to the document yet.
+	bool empty() const { return m_openObjects.empty() && m_lastKeys.size() == 1 && !m_lastKeys.back(); }
+	/// @returns true if one of the written values could not be serialised.
+	/// The output is incomplete in that case.
+	bool failed() const { return m_failed; }
+
+private:
+	/// Starts a new member of the innermost open object, i.e. writes the separator and the key.
+	void beginMember(std::string const& _key, bool _checkOrder = true);
+	/// Writes a value serialised by jsonPrint() as the member started last.
+	void writeValue(std::string _serialisedValue);
+	/// Closes the innermost open object.
+	void closeObject();
+	std::string newLine(size_t _depth) const;
+
+	std::ostream& m_out;
+	JsonFormat m_format;
+	/// Keys of the objects that are currently open, excluding the document itself.
+	std::vector<std::string> m_openObjects;
+	/// Key of the last member written to each open object, including the document itself.
+	std::vector<std::optional<std::string>> m_lastKeys;
+	bool m_failed = false;
+};
+
 /// Parse a JSON string (@a _input) with enabled strict-mode and writes resulting JSON object to (@a _json)
 /// \param _input JSON input string
 /// \param _json [out] resulting JSON object
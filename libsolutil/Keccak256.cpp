@@ -22,8 +22,10 @@
 
 #include <libsolutil/Keccak256.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <numeric>
 
 namespace solidity::util
 {
@@ -62,7 +64,7 @@ static uint64_t const RC[24] = \
 	0x8000000080008081ULL, 0x8000000000008080ULL, 0x80000001ULL, 0x8000000080008008ULL};
 
 /*** Helper macros to unroll the permutation. ***/
-#define rol(x, s) (((x) << s) | ((x) >> (64 - s)))
+#define rol(x, s) (((x) << (s)) | ((x) >> (64 - (s))))
 #define REPEAT6(e) e e e e e e
 #define REPEAT24(e) REPEAT6(e e e e)
 #define REPEAT5(e) e e e e e
@@ -71,23 +73,25 @@ static uint64_t const RC[24] = \
 	REPEAT5(e; v = static_cast<type>(v + s);)
 
 /*** Keccak-f[1600] ***/
-static inline void keccakf(void* state) {
-	auto* a = static_cast<uint64_t*>(state);
-	uint64_t b[5] = {0};
+/// Applies the permutation to the state `a`. `Word` is either uint64_t or a vector of
+/// uint64_t, the latter permuting one independent state per vector element.
+template<typename Word>
+static inline void keccakf(Word* a) {
+	Word b[5] = {};
 
 	for (int i = 0; i < 24; i++)
 	{
 		uint8_t x, y;
 		// Theta
 		FOR5(uint8_t, x, 1,
-			b[x] = 0;
+			b[x] = Word{};
 			FOR5(uint8_t, y, 5,
 				b[x] ^= a[x + y]; ))
 		FOR5(uint8_t, x, 1,
 			FOR5(uint8_t, y, 5,
 				a[y + x] ^= b[(x + 4) % 5] ^ rol(b[(x + 1) % 5], 1); ))
 		// Rho and pi
-		uint64_t t = a[1];
+		Word t = a[1];
 		x = 0;
 		REPEAT24(b[0] = a[pi[x]];
 				a[pi[x]] = rol(t, rho[x]);
@@ -106,77 +110,128 @@ static inline void keccakf(void* state) {
 	}
 }
 
-/******** The FIPS202-defined functions. ********/
-
-/*** Some helper macros. ***/
-
-#define _(S) do { S } while (0)
-#define FOR(i, ST, L, S) \
-	_(for (size_t i = 0; i < L; i += ST) { S; })
-#define mkapply_ds(NAME, S)                                          \
-	static inline void NAME(uint8_t* dst,                              \
-							uint8_t const* src,                        \
-							size_t len) {                              \
-		FOR(i, 1, len, S);                                               \
-	}
-#define mkapply_sd(NAME, S)                                          \
-	static inline void NAME(uint8_t const* src,                        \
-							uint8_t* dst,                              \
-							size_t len) {                              \
-		FOR(i, 1, len, S);                                               \
+/******** The sponge construction for Keccak-256. ********/
+
+// Parameters used:
+// The 0x01 is the specific padding for keccak (sha3 uses 0x06) and
+// the way the round size (or window or whatever it was) is calculated.
+// 200 - (256 / 4) is the "rate"
+size_t constexpr rate = 200 - (256 / 4);
+uint8_t constexpr delim = 0x01;
+
+#if defined(__GNUC__)
+/// Vector of independent Keccak lanes that keccak256Many permutes together.
+/// Two lanes fit the SIMD registers available on every x86-64 and AArch64 target.
+typedef uint64_t KeccakLanes __attribute__((vector_size(16)));
+size_t constexpr batchSize = 2;
+#endif
+
+inline void xorLane(uint64_t& _word, size_t, uint64_t _value) { _word ^= _value; }
+inline uint64_t getLane(uint64_t _word, size_t) { return _word; }
+#if defined(__GNUC__)
+inline void xorLane(KeccakLanes& _word, size_t _lane, uint64_t _value) { _word[_lane] ^= _value; }
+inline uint64_t getLane(KeccakLanes const& _word, size_t _lane) { return _word[_lane]; }
+#endif
+
+/// XORs a full block into the given lane of the state, a 64-bit word at a time.
+/// Like the permutation, this uses the little-endian lane layout of the host.
+template<typename Word>
+inline void absorbBlock(Word* _state, size_t _lane, uint8_t const* _block)
+{
+	for (size_t i = 0; i < rate / 8; ++i)
+	{
+		uint64_t word;
+		memcpy(&word, _block + 8 * i, 8);
+		xorLane(_state[i], _lane, word);
 	}
+}
 
-mkapply_ds(xorin, dst[i] ^= src[i])  // xorin
-mkapply_sd(setout, dst[i] = src[i])  // setout
-
-#define P keccakf
-#define Plen 200
-
-// Fold P*F over the full blocks of an input.
-#define foldP(I, L, F) \
-	while (L >= rate) {  \
-		F(a, I, rate);     \
-		P(a);              \
-		I += rate;         \
-		L -= rate;         \
-	}
+/// XORs the remaining `_length` < rate bytes of the input and the padding into the given lane.
+template<typename Word>
+inline void absorbLastBlock(Word* _state, size_t _lane, uint8_t const* _input, size_t _length)
+{
+	uint8_t block[rate] = {0};
+	if (_length > 0)
+		memcpy(block, _input, _length);
+	block[_length] ^= delim;
+	block[rate - 1] ^= 0x80;
+	absorbBlock(_state, _lane, block);
+}
 
-/** The sponge-based hash construction. **/
-inline void hash(
-	uint8_t* out,
-	size_t outlen,
-	uint8_t const* in,
-	size_t inlen,
-	size_t rate,
-	uint8_t delim
-)
+template<typename Word>
+inline void squeeze(Word const* _state, size_t _lane, uint8_t* _output)
 {
-	uint8_t a[Plen] = {0};
-	// Absorb input.
-	foldP(in, inlen, xorin);
-	// Xor in the DS and pad frame.
-	a[inlen] ^= delim;
-	a[rate - 1] ^= 0x80;
-	// Xor in the last block.
-	xorin(a, in, inlen);
-	// Apply P
-	P(a);
-	// Squeeze output.
-	foldP(out, outlen, setout);
-	setout(a, out, outlen);
-	memset(a, 0, 200);
+	for (size_t i = 0; i < 4; ++i)
+	{
+		uint64_t word = getLane(_state[i], _lane);
+		memcpy(_output + 8 * i, &word, 8);
+	}
 }
 
 }
 
 h256 keccak256(bytesConstRef _input)
 {
+	uint64_t state[25] = {0};
+	uint8_t const* input = _input.data();
+	size_t length = _input.size();
+	for (; length >= rate; input += rate, length -= rate)
+	{
+		absorbBlock(state, 0, input);
+		keccakf(state);
+	}
+	absorbLastBlock(state, 0, input, length);
+	keccakf(state);
+
 	h256 output;
-	// Parameters used:
-	// The 0x01 is the specific padding for keccak (sha3 uses 0x06) and
-	// the way the round size (or window or whatever it was) is calculated.
-	// 200 - (256 / 4) is the "rate"
-	hash(output.data(), output.size, _input.data(), _input.size(), 200 - (256 / 4), 0x01);
+	squeeze(state, 0, output.data());
+	return output;
+}
+
+std::vector<h256> keccak256Many(std::vector<bytesConstRef> const& _inputs)
+{
+	std::vector<h256> output(_inputs.size());
+
+	// Inputs that need the same number of permutations are hashed in batches.
+	// Whatever cannot be grouped that way is hashed one by one.
+	auto fullBlocks = [&](size_t _index) { return _inputs[_index].size() / rate; };
+	std::vector<size_t> order(_inputs.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](size_t _a, size_t _b) { return fullBlocks(_a) < fullBlocks(_b); });
+
+	size_t next = 0;
+#if defined(__GNUC__)
+	while (next + batchSize <= order.size())
+	{
+		size_t const blocks = fullBlocks(order[next]);
+		if (fullBlocks(order[next + batchSize - 1]) != blocks)
+		{
+			output[order[next]] = keccak256(_inputs[order[next]]);
+			++next;
+			continue;
+		}
+
+		KeccakLanes state[25] = {};
+		for (size_t block = 0; block < blocks; ++block)
+		{
+			for (size_t i = 0; i < batchSize; ++i)
+				absorbBlock(state, i, _inputs[order[next + i]].data() + block * rate);
+			keccakf(state);
+		}
+		for (size_t i = 0; i < batchSize; ++i)
+		{
+			bytesConstRef input = _inputs[order[next + i]];
+			absorbLastBlock(state, i, input.data() + blocks * rate, input.size() - blocks * rate);
+		}
+		keccakf(state);
+		for (size_t i = 0; i < batchSize; ++i)
+			squeeze(state, i, output[order[next + i]].data());
+		next += batchSize;
+	}
+#endif
+	for (; next < order.size(); ++next)
+		output[order[next]] = keccak256(_inputs[order[next]]);
+
 	return output;
 }
 
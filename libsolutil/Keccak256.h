@@ -27,6 +27,7 @@
 #include <libsolutil/FixedHash.h>
 
 #include <string>
+#include <vector>
 
 namespace solidity::util
 {
@@ -34,6 +35,10 @@ namespace solidity::util
 /// Calculate Keccak-256 hash of the given input, returning as a 256-bit hash.
 h256 keccak256(bytesConstRef _input);
 
+/// Calculate the Keccak-256 hashes of all given inputs. Equivalent to calling keccak256 on each
+/// of them, but hashes several inputs of similar length at the same time.
+std::vector<h256> keccak256Many(std::vector<bytesConstRef> const& _inputs);
+
 /// Calculate Keccak-256 hash of the given input, returning as a 256-bit hash.
 inline h256 keccak256(bytes const& _input) { return keccak256(bytesConstRef(&_input)); }
 
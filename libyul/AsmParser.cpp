@@ -67,7 +67,8 @@ langutil::DebugData::ConstPtr Parser::createDebugData() const
 		case UseSourceLocationFrom::Scanner:
 			return DebugData::create(ParserBase::currentLocation(), ParserBase::currentLocation());
 		case UseSourceLocationFrom::LocationOverride:
-			return DebugData::create(m_locationOverride, m_locationOverride);
+			solAssert(m_debugDataOverride);
+			return m_debugDataOverride;
 		case UseSourceLocationFrom::Comments:
 			return DebugData::create(ParserBase::currentLocation(), m_locationFromComment, m_astIDFromComment);
 	}
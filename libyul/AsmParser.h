@@ -61,6 +61,11 @@ public:
 		ParserBase(_errorReporter),
 		m_dialect(_dialect),
 		m_locationOverride{_locationOverride ? *_locationOverride : langutil::SourceLocation{}},
+		m_debugDataOverride{
+			_locationOverride ?
+			langutil::DebugData::create(*_locationOverride, *_locationOverride) :
+			nullptr
+		},
 		m_useSourceLocationFrom{
 			_locationOverride ?
 			UseSourceLocationFrom::LocationOverride :
@@ -159,6 +164,8 @@ private:
 
 	std::optional<std::map<unsigned, std::shared_ptr<std::string const>>> m_sourceNames;
 	langutil::SourceLocation m_locationOverride;
+	/// Debug data shared by all nodes if the location is overridden, since it never changes.
+	langutil::DebugData::ConstPtr m_debugDataOverride;
 	langutil::SourceLocation m_locationFromComment;
 	std::optional<int64_t> m_astIDFromComment;
 	UseSourceLocationFrom m_useSourceLocationFrom = UseSourceLocationFrom::Scanner;
@@ -58,6 +58,13 @@ void ObjectOptimizer::optimize(Object& _object, Settings const& _settings)
 {
 	yulAssert(_object.subId == std::numeric_limits<size_t>::max(), "Not a top-level object.");
 
+	if (m_yulStringGeneration != YulStringRepository::generation())
+	{
+		// The cached ASTs and dialects were invalidated by resetting the repository.
+		m_cachedObjects.clear();
+		m_yulStringGeneration = YulStringRepository::generation();
+	}
+
 	optimize(_object, _settings, true /* _isCreation */);
 }
 
@@ -20,6 +20,7 @@
 
 #include <libyul/ASTForward.h>
 #include <libyul/Object.h>
+#include <libyul/YulString.h>
 
 #include <liblangutil/EVMVersion.h>
 
@@ -44,7 +45,8 @@ Dialect const& languageToDialect(Language _language, langutil::EVMVersion _versi
 /// Also, acts as a transparent cache for optimized objects.
 ///
 /// The cache is designed to allow sharing its instances widely across the compiler, without the
-/// need to invalidate entries due to changing settings or context.
+/// need to invalidate entries due to changing settings or context. The cached ASTs refer to
+/// YulStrings, so the cache is only discarded when the YulStringRepository is reset.
 /// Caching is performed at the granularity of individual ASTs rather than whole object trees,
 /// which means that reuse is possible even within a single hierarchy, e.g. when creation and
 /// deployed objects have common dependencies.
@@ -93,6 +95,8 @@ private:
 	);
 
 	std::map<util::h256, CachedObject> m_cachedObjects;
+	/// Generation of the YulStringRepository the cached objects were created in.
+	size_t m_yulStringGeneration = YulStringRepository::generation();
 };
 
 }
@@ -0,0 +1,749 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Compact binary encoding of Yul objects.
+ */
+
+#include <libyul/ObjectSerialiser.h>
+
+#include <libyul/AsmAnalysis.h>
+#include <libyul/AsmAnalysisInfo.h>
+#include <libyul/AST.h>
+#include <libyul/Dialect.h>
+#include <libyul/Exceptions.h>
+#include <libyul/Object.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/Numeric.h>
+
+#include <limits>
+#include <map>
+#include <vector>
+
+using namespace solidity;
+using namespace solidity::langutil;
+using namespace solidity::util;
+using namespace solidity::yul;
+
+namespace
+{
+
+/// Layout: magic, format version, string table, literal pool, debug data table, root object.
+/// All integers are LEB128 encoded, signed integers are zig-zag encoded first.
+std::string_view constexpr magic{"YULB"};
+uint8_t constexpr formatVersion = 1;
+
+enum class NodeKind: uint8_t
+{
+	ExpressionStatement,
+	Assignment,
+	VariableDeclaration,
+	FunctionDefinition,
+	If,
+	Switch,
+	ForLoop,
+	Break,
+	Continue,
+	Leave,
+	Block,
+	FunctionCall,
+	Identifier,
+	Literal,
+	BuiltinName,
+	Object,
+	Data
+};
+
+enum class LiteralValueKind: uint8_t
+{
+	Number,
+	NumberWithHint,
+	BuiltinString
+};
+
+class Encoder
+{
+public:
+	void byte(uint8_t _value) { m_output.push_back(static_cast<char>(_value)); }
+	void kind(NodeKind _kind) { byte(static_cast<uint8_t>(_kind)); }
+	void number(uint64_t _value)
+	{
+		for (; _value >= 0x80; _value >>= 7)
+			byte(static_cast<uint8_t>(_value | 0x80));
+		byte(static_cast<uint8_t>(_value));
+	}
+	void signedNumber(int64_t _value)
+	{
+		number((static_cast<uint64_t>(_value) << 1) ^ static_cast<uint64_t>(_value >> 63));
+	}
+	void data(std::string_view _value)
+	{
+		number(_value.size());
+		m_output += _value;
+	}
+
+	std::string& output() { return m_output; }
+
+private:
+	std::string m_output;
+};
+
+class Decoder
+{
+public:
+	explicit Decoder(std::string_view _input): m_input(_input) {}
+
+	uint8_t byte()
+	{
+		yulAssert(m_position < m_input.size(), "Unexpected end of binary Yul object.");
+		return static_cast<uint8_t>(m_input[m_position++]);
+	}
+	NodeKind kind()
+	{
+		uint8_t value = byte();
+		yulAssert(value <= static_cast<uint8_t>(NodeKind::Data), "Invalid node kind in binary Yul object.");
+		return static_cast<NodeKind>(value);
+	}
+	uint64_t number()
+	{
+		uint64_t result = 0;
+		for (unsigned shift = 0; ; shift += 7)
+		{
+			yulAssert(shift < 64, "Invalid number in binary Yul object.");
+			uint8_t value = byte();
+			result |= static_cast<uint64_t>(value & 0x7f) << shift;
+			if (!(value & 0x80))
+				return result;
+		}
+	}
+	int64_t signedNumber()
+	{
+		uint64_t value = number();
+		return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+	}
+	/// Reads the number of entries of a table whose entries take at least one byte each.
+	size_t count()
+	{
+		uint64_t result = number();
+		yulAssert(result <= m_input.size() - m_position, "Invalid table size in binary Yul object.");
+		return static_cast<size_t>(result);
+	}
+	std::string_view data()
+	{
+		uint64_t size = number();
+		yulAssert(size <= m_input.size() - m_position, "Unexpected end of binary Yul object.");
+		std::string_view result = m_input.substr(m_position, size);
+		m_position += size;
+		return result;
+	}
+	/// Reads @a _size bytes without a length prefix.
+	std::string_view raw(size_t _size)
+	{
+		yulAssert(_size <= m_input.size() - m_position, "Unexpected end of binary Yul object.");
+		std::string_view result = m_input.substr(m_position, _size);
+		m_position += _size;
+		return result;
+	}
+
+	bool atEnd() const { return m_position == m_input.size(); }
+
+private:
+	std::string_view m_input;
+	size_t m_position = 0;
+};
+
+/// Deduplicated entries, referenced by their index.
+struct Pool
+{
+	size_t add(std::string _entry)
+	{
+		auto [it, inserted] = indices.try_emplace(std::move(_entry), entries.size());
+		if (inserted)
+			entries.emplace_back(&it->first);
+		return it->second;
+	}
+
+	std::map<std::string, size_t> indices;
+	std::vector<std::string const*> entries;
+};
+
+class ObjectEncoder
+{
+public:
+	explicit ObjectEncoder(bool _includeDebugData): m_includeDebugData(_includeDebugData) {}
+
+	std::string run(Object const& _object)
+	{
+		encodeObject(_object);
+
+		Encoder header;
+		header.output() += magic;
+		header.byte(formatVersion);
+		header.number(m_strings.entries.size());
+		for (std::string const* entry: m_strings.entries)
+			header.data(*entry);
+		header.number(m_literals.entries.size());
+		for (std::string const* entry: m_literals.entries)
+			header.output() += *entry;
+		header.number(m_debugData.size());
+		for (std::string const& entry: m_debugData)
+			header.output() += entry;
+		return std::move(header.output()) + m_body.output();
+	}
+
+	void operator()(ExpressionStatement const& _statement)
+	{
+		node(NodeKind::ExpressionStatement, _statement.debugData);
+		expression(_statement.expression);
+	}
+	void operator()(Assignment const& _assignment)
+	{
+		node(NodeKind::Assignment, _assignment.debugData);
+		m_body.number(_assignment.variableNames.size());
+		for (Identifier const& variable: _assignment.variableNames)
+			name(variable.debugData, variable.name);
+		yulAssert(_assignment.value);
+		expression(*_assignment.value);
+	}
+	void operator()(VariableDeclaration const& _declaration)
+	{
+		node(NodeKind::VariableDeclaration, _declaration.debugData);
+		names(_declaration.variables);
+		m_body.byte(_declaration.value ? 1 : 0);
+		if (_declaration.value)
+			expression(*_declaration.value);
+	}
+	void operator()(FunctionDefinition const& _function)
+	{
+		node(NodeKind::FunctionDefinition, _function.debugData);
+		m_body.number(stringIndex(_function.name.str()));
+		names(_function.parameters);
+		names(_function.returnVariables);
+		block(_function.body);
+	}
+	void operator()(If const& _if)
+	{
+		node(NodeKind::If, _if.debugData);
+		yulAssert(_if.condition);
+		expression(*_if.condition);
+		block(_if.body);
+	}
+	void operator()(Switch const& _switch)
+	{
+		node(NodeKind::Switch, _switch.debugData);
+		yulAssert(_switch.expression);
+		expression(*_switch.expression);
+		m_body.number(_switch.cases.size());
+		for (Case const& _case: _switch.cases)
+		{
+			m_body.number(debugData(_case.debugData));
+			m_body.byte(_case.value ? 1 : 0);
+			if (_case.value)
+				literal(*_case.value);
+			block(_case.body);
+		}
+	}
+	void operator()(ForLoop const& _loop)
+	{
+		node(NodeKind::ForLoop, _loop.debugData);
+		block(_loop.pre);
+		yulAssert(_loop.condition);
+		expression(*_loop.condition);
+		block(_loop.post);
+		block(_loop.body);
+	}
+	void operator()(Break const& _break) { node(NodeKind::Break, _break.debugData); }
+	void operator()(Continue const& _continue) { node(NodeKind::Continue, _continue.debugData); }
+	void operator()(Leave const& _leave) { node(NodeKind::Leave, _leave.debugData); }
+	void operator()(Block const& _block)
+	{
+		m_body.kind(NodeKind::Block);
+		block(_block);
+	}
+
+	void operator()(FunctionCall const& _call)
+	{
+		node(NodeKind::FunctionCall, _call.debugData);
+		if (Identifier const* identifier = std::get_if<Identifier>(&_call.functionName))
+		{
+			m_body.kind(NodeKind::Identifier);
+			name(identifier->debugData, identifier->name);
+		}
+		else
+		{
+			BuiltinName const& builtin = std::get<BuiltinName>(_call.functionName);
+			m_body.kind(NodeKind::BuiltinName);
+			m_body.number(debugData(builtin.debugData));
+			m_body.number(stringIndex(m_dialect->builtin(builtin.handle).name));
+		}
+		m_body.number(_call.arguments.size());
+		for (Expression const& argument: _call.arguments)
+			expression(argument);
+	}
+	void operator()(Identifier const& _identifier)
+	{
+		m_body.kind(NodeKind::Identifier);
+		name(_identifier.debugData, _identifier.name);
+	}
+	void operator()(Literal const& _literal)
+	{
+		m_body.kind(NodeKind::Literal);
+		literal(_literal);
+	}
+
+private:
+	void encodeObject(Object const& _object)
+	{
+		yulAssert(_object.hasCode(), "No code");
+		m_body.kind(NodeKind::Object);
+		m_body.number(stringIndex(_object.name));
+		m_body.number(_object.subId == std::numeric_limits<size_t>::max() ? 0 : _object.subId + 1);
+
+		bool hasSourceNames = _object.debugData && _object.debugData->sourceNames;
+		m_body.byte(hasSourceNames ? 1 : 0);
+		if (hasSourceNames)
+		{
+			m_body.number(_object.debugData->sourceNames->size());
+			for (auto const& [index, sourceName]: *_object.debugData->sourceNames)
+			{
+				m_body.number(index);
+				m_body.number(stringIndex(*sourceName));
+			}
+		}
+
+		m_dialect = _object.dialect();
+		block(_object.code()->root());
+
+		m_body.number(_object.subObjects.size());
+		for (std::shared_ptr<ObjectNode> const& subNode: _object.subObjects)
+			if (auto const* subObject = dynamic_cast<Object const*>(subNode.get()))
+				encodeObject(*subObject);
+			else
+			{
+				auto const* data = dynamic_cast<Data const*>(subNode.get());
+				yulAssert(data);
+				m_body.kind(NodeKind::Data);
+				m_body.number(stringIndex(data->name));
+				m_body.data(asString(data->data));
+			}
+
+		m_body.number(_object.subIndexByName.size());
+		for (auto const& [subName, subIndex]: _object.subIndexByName)
+		{
+			m_body.number(stringIndex(subName));
+			m_body.number(subIndex);
+		}
+	}
+
+	void node(NodeKind _kind, DebugData::ConstPtr const& _debugData)
+	{
+		m_body.kind(_kind);
+		m_body.number(debugData(_debugData));
+	}
+	void expression(Expression const& _expression) { std::visit(*this, _expression); }
+	void block(Block const& _block)
+	{
+		m_body.number(debugData(_block.debugData));
+		m_body.number(_block.statements.size());
+		for (Statement const& statement: _block.statements)
+			std::visit(*this, statement);
+	}
+	void name(DebugData::ConstPtr const& _debugData, YulName _name)
+	{
+		m_body.number(debugData(_debugData));
+		m_body.number(stringIndex(_name.str()));
+	}
+	void names(NameWithDebugDataList const& _names)
+	{
+		m_body.number(_names.size());
+		for (NameWithDebugData const& variable: _names)
+			name(variable.debugData, variable.name);
+	}
+	void literal(Literal const& _literal)
+	{
+		m_body.number(debugData(_literal.debugData));
+		m_body.byte(static_cast<uint8_t>(_literal.kind));
+
+		Encoder entry;
+		if (_literal.value.unlimited())
+		{
+			entry.byte(static_cast<uint8_t>(LiteralValueKind::BuiltinString));
+			entry.number(stringIndex(_literal.value.builtinStringLiteralValue()));
+		}
+		else
+		{
+			entry.byte(static_cast<uint8_t>(
+				_literal.value.hint() ? LiteralValueKind::NumberWithHint : LiteralValueKind::Number
+			));
+			entry.data(asString(toCompactBigEndian(_literal.value.value())));
+			if (_literal.value.hint())
+				entry.number(stringIndex(*_literal.value.hint()));
+		}
+		m_body.number(m_literals.add(std::move(entry.output())));
+	}
+
+	size_t stringIndex(std::string_view _value) { return m_strings.add(std::string(_value)); }
+
+	/// @returns the index of @a _debugData in the debug data table plus one or zero if there is none.
+	size_t debugData(DebugData::ConstPtr const& _debugData)
+	{
+		if (!m_includeDebugData || !_debugData)
+			return 0;
+		auto [it, inserted] = m_debugDataIndices.try_emplace(_debugData.get(), m_debugData.size() + 1);
+		if (inserted)
+		{
+			Encoder entry;
+			location(entry, _debugData->nativeLocation);
+			location(entry, _debugData->originLocation);
+			entry.byte(_debugData->astID ? 1 : 0);
+			if (_debugData->astID)
+				entry.signedNumber(*_debugData->astID);
+			m_debugData.emplace_back(std::move(entry.output()));
+		}
+		return it->second;
+	}
+	void location(Encoder& _entry, SourceLocation const& _location)
+	{
+		_entry.number(_location.sourceName ? stringIndex(*_location.sourceName) + 1 : 0);
+		_entry.signedNumber(_location.start);
+		_entry.signedNumber(_location.end);
+	}
+
+	bool const m_includeDebugData;
+	Dialect const* m_dialect = nullptr;
+	Encoder m_body;
+	Pool m_strings;
+	Pool m_literals;
+	std::map<DebugData const*, size_t> m_debugDataIndices;
+	std::vector<std::string> m_debugData;
+};
+
+class ObjectDecoder
+{
+public:
+	ObjectDecoder(std::string_view _input, Dialect const& _dialect): m_input(_input), m_dialect(_dialect) {}
+
+	std::shared_ptr<Object> run()
+	{
+		yulAssert(m_input.raw(magic.size()) == magic, "Not a binary Yul object.");
+		yulAssert(m_input.byte() == formatVersion, "Unsupported binary Yul object format version.");
+
+		m_strings.resize(m_input.count());
+		for (std::string& entry: m_strings)
+			entry = m_input.data();
+		m_sourceNames.resize(m_strings.size());
+
+		m_literals.resize(m_input.count());
+		for (LiteralValue& entry: m_literals)
+			entry = literalValue();
+
+		m_debugData.resize(m_input.count());
+		for (DebugData::ConstPtr& entry: m_debugData)
+		{
+			SourceLocation nativeLocation = location();
+			SourceLocation originLocation = location();
+			std::optional<int64_t> astID;
+			if (m_input.byte())
+				astID = m_input.signedNumber();
+			entry = DebugData::create(std::move(nativeLocation), std::move(originLocation), astID);
+		}
+
+		yulAssert(m_input.kind() == NodeKind::Object, "Expected an object.");
+		std::shared_ptr<Object> object = decodeObject();
+		yulAssert(m_input.atEnd(), "Trailing data after binary Yul object.");
+		return object;
+	}
+
+private:
+	std::shared_ptr<Object> decodeObject()
+	{
+		auto object = std::make_shared<Object>();
+		object->name = string();
+		size_t subId = m_input.number();
+		if (subId > 0)
+			object->subId = subId - 1;
+
+		std::optional<SourceNameMap> sourceNames;
+		if (m_input.byte())
+		{
+			sourceNames.emplace();
+			for (size_t count = m_input.number(); count > 0; --count)
+			{
+				uint64_t index = m_input.number();
+				yulAssert(index <= std::numeric_limits<unsigned>::max(), "Invalid source index.");
+				(*sourceNames)[static_cast<unsigned>(index)] = sourceName(m_input.number());
+			}
+		}
+		object->debugData = std::make_shared<ObjectDebugData>(ObjectDebugData{std::move(sourceNames)});
+		object->setCode(std::make_shared<AST>(m_dialect, block()));
+
+		for (size_t count = m_input.number(); count > 0; --count)
+		{
+			NodeKind kind = m_input.kind();
+			if (kind == NodeKind::Object)
+				object->subObjects.emplace_back(decodeObject());
+			else
+			{
+				yulAssert(kind == NodeKind::Data, "Expected an object or data.");
+				std::string dataName = string();
+				object->subObjects.emplace_back(std::make_shared<Data>(std::move(dataName), asBytes(m_input.data())));
+			}
+		}
+
+		for (size_t count = m_input.number(); count > 0; --count)
+		{
+			std::string subName = string();
+			size_t subIndex = m_input.number();
+			yulAssert(subIndex < object->subObjects.size(), "Invalid sub-object index.");
+			object->subIndexByName.emplace(std::move(subName), subIndex);
+		}
+
+		object->analysisInfo = std::make_shared<AsmAnalysisInfo>(AsmAnalyzer::analyzeStrictAssertCorrect(*object));
+		return object;
+	}
+
+	Statement statement()
+	{
+		NodeKind kind = m_input.kind();
+		if (kind == NodeKind::Block)
+			return block();
+		DebugData::ConstPtr nodeDebugData = debugData();
+		switch (kind)
+		{
+		case NodeKind::ExpressionStatement:
+			return ExpressionStatement{std::move(nodeDebugData), expression()};
+		case NodeKind::Assignment:
+		{
+			Assignment assignment{std::move(nodeDebugData), {}, {}};
+			for (size_t count = m_input.number(); count > 0; --count)
+				assignment.variableNames.emplace_back(identifier());
+			assignment.value = std::make_unique<Expression>(expression());
+			return assignment;
+		}
+		case NodeKind::VariableDeclaration:
+		{
+			VariableDeclaration declaration{std::move(nodeDebugData), names(), {}};
+			if (m_input.byte())
+				declaration.value = std::make_unique<Expression>(expression());
+			return declaration;
+		}
+		case NodeKind::FunctionDefinition:
+		{
+			FunctionDefinition function{std::move(nodeDebugData), YulName{string()}, {}, {}, {}};
+			function.parameters = names();
+			function.returnVariables = names();
+			function.body = block();
+			return function;
+		}
+		case NodeKind::If:
+		{
+			If ifStatement{std::move(nodeDebugData), std::make_unique<Expression>(expression()), {}};
+			ifStatement.body = block();
+			return ifStatement;
+		}
+		case NodeKind::Switch:
+		{
+			Switch switchStatement{std::move(nodeDebugData), std::make_unique<Expression>(expression()), {}};
+			for (size_t count = m_input.number(); count > 0; --count)
+			{
+				Case caseStatement{debugData(), {}, {}};
+				if (m_input.byte())
+					caseStatement.value = std::make_unique<Literal>(literal());
+				caseStatement.body = block();
+				switchStatement.cases.emplace_back(std::move(caseStatement));
+			}
+			return switchStatement;
+		}
+		case NodeKind::ForLoop:
+		{
+			ForLoop loop{std::move(nodeDebugData), block(), {}, {}, {}};
+			loop.condition = std::make_unique<Expression>(expression());
+			loop.post = block();
+			loop.body = block();
+			return loop;
+		}
+		case NodeKind::Break:
+			return Break{std::move(nodeDebugData)};
+		case NodeKind::Continue:
+			return Continue{std::move(nodeDebugData)};
+		case NodeKind::Leave:
+			return Leave{std::move(nodeDebugData)};
+		default:
+			yulAssert(false, "Invalid statement in binary Yul object.");
+		}
+		util::unreachable();
+	}
+
+	Expression expression()
+	{
+		switch (m_input.kind())
+		{
+		case NodeKind::FunctionCall:
+		{
+			FunctionCall call{debugData(), {}, {}};
+			NodeKind nameKind = m_input.kind();
+			if (nameKind == NodeKind::Identifier)
+				call.functionName = identifier();
+			else
+			{
+				yulAssert(nameKind == NodeKind::BuiltinName, "Invalid function name in binary Yul object.");
+				DebugData::ConstPtr nameDebugData = debugData();
+				std::string const& builtinName = string();
+				std::optional<BuiltinHandle> handle = m_dialect.findBuiltin(builtinName);
+				yulAssert(handle, "Builtin \"" + builtinName + "\" is not available in the dialect.");
+				call.functionName = BuiltinName{std::move(nameDebugData), *handle};
+			}
+			for (size_t count = m_input.number(); count > 0; --count)
+				call.arguments.emplace_back(expression());
+			return call;
+		}
+		case NodeKind::Identifier:
+			return identifier();
+		case NodeKind::Literal:
+			return literal();
+		default:
+			yulAssert(false, "Invalid expression in binary Yul object.");
+		}
+		util::unreachable();
+	}
+
+	Block block()
+	{
+		Block result{debugData(), {}};
+		for (size_t count = m_input.number(); count > 0; --count)
+			result.statements.emplace_back(statement());
+		return result;
+	}
+
+	Identifier identifier()
+	{
+		DebugData::ConstPtr nodeDebugData = debugData();
+		return Identifier{std::move(nodeDebugData), YulName{string()}};
+	}
+
+	NameWithDebugDataList names()
+	{
+		NameWithDebugDataList result;
+		for (size_t count = m_input.number(); count > 0; --count)
+		{
+			DebugData::ConstPtr nodeDebugData = debugData();
+			result.emplace_back(NameWithDebugData{std::move(nodeDebugData), YulName{string()}});
+		}
+		return result;
+	}
+
+	Literal literal()
+	{
+		DebugData::ConstPtr nodeDebugData = debugData();
+		uint8_t kind = m_input.byte();
+		yulAssert(kind <= static_cast<uint8_t>(LiteralKind::String), "Invalid literal kind in binary Yul object.");
+		uint64_t index = m_input.number();
+		yulAssert(index < m_literals.size(), "Invalid literal index in binary Yul object.");
+		return Literal{std::move(nodeDebugData), static_cast<LiteralKind>(kind), m_literals[index]};
+	}
+
+	LiteralValue literalValue()
+	{
+		switch (static_cast<LiteralValueKind>(m_input.byte()))
+		{
+		case LiteralValueKind::BuiltinString:
+			return LiteralValue{string()};
+		case LiteralValueKind::Number:
+			return LiteralValue{word()};
+		case LiteralValueKind::NumberWithHint:
+		{
+			u256 value = word();
+			return LiteralValue{value, string()};
+		}
+		default:
+			yulAssert(false, "Invalid literal value in binary Yul object.");
+		}
+		util::unreachable();
+	}
+
+	u256 word()
+	{
+		std::string_view bigEndian = m_input.data();
+		yulAssert(bigEndian.size() <= 32, "Literal value too large in binary Yul object.");
+		return fromBigEndian<u256>(bigEndian);
+	}
+
+	std::string const& string()
+	{
+		uint64_t index = m_input.number();
+		yulAssert(index < m_strings.size(), "Invalid string index in binary Yul object.");
+		return m_strings[index];
+	}
+
+	std::shared_ptr<std::string const> const& sourceName(uint64_t _index)
+	{
+		yulAssert(_index < m_strings.size(), "Invalid string index in binary Yul object.");
+		if (!m_sourceNames[_index])
+			m_sourceNames[_index] = std::make_shared<std::string const>(m_strings[_index]);
+		return m_sourceNames[_index];
+	}
+
+	SourceLocation location()
+	{
+		SourceLocation result;
+		if (uint64_t index = m_input.number())
+			result.sourceName = sourceName(index - 1);
+		result.start = intValue();
+		result.end = intValue();
+		return result;
+	}
+
+	int intValue()
+	{
+		int64_t value = m_input.signedNumber();
+		yulAssert(
+			value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max(),
+			"Invalid source location in binary Yul object."
+		);
+		return static_cast<int>(value);
+	}
+
+	DebugData::ConstPtr debugData()
+	{
+		uint64_t index = m_input.number();
+		if (index == 0)
+			return nullptr;
+		yulAssert(index <= m_debugData.size(), "Invalid debug data index in binary Yul object.");
+		return m_debugData[index - 1];
+	}
+
+	Decoder m_input;
+	Dialect const& m_dialect;
+	std::vector<std::string> m_strings;
+	/// Source names are shared between all locations that refer to them, as done by the parser.
+	std::vector<std::shared_ptr<std::string const>> m_sourceNames;
+	std::vector<LiteralValue> m_literals;
+	std::vector<DebugData::ConstPtr> m_debugData;
+};
+
+}
+
+std::string ObjectSerialiser::serialise(Object const& _object, bool _includeDebugData)
+{
+	return ObjectEncoder{_includeDebugData}.run(_object);
+}
+
+std::shared_ptr<Object> ObjectSerialiser::deserialise(std::string_view _input, Dialect const& _dialect)
+{
+	return ObjectDecoder{_input, _dialect}.run();
+}
@@ -0,0 +1,56 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Compact binary encoding of Yul objects.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace solidity::yul
+{
+
+class Dialect;
+class Object;
+
+/**
+ * Serialises Yul objects including their sub-objects and data into a compact binary format
+ * and reconstructs analysed objects from it without going through the parser.
+ *
+ * All identifiers and strings are stored once in a string table, literal values in a literal pool
+ * and debug data in a table that preserves sharing between AST nodes. Builtins are stored by name
+ * and resolved against the dialect when deserialising.
+ */
+class ObjectSerialiser
+{
+public:
+	/// @returns the binary encoding of @a _object.
+	/// The debug data of the AST nodes, i.e. source locations and AST IDs, is only included if
+	/// @a _includeDebugData is set. The source name mapping of the objects is always included.
+	static std::string serialise(Object const& _object, bool _includeDebugData = true);
+
+	/// Reconstructs an object serialised by serialise(). The code of the object and of all its sub-objects
+	/// uses @a _dialect and is analysed, i.e. the objects come with their analysis info.
+	/// Asserts that the input is well-formed and the code is valid in @a _dialect.
+	static std::shared_ptr<Object> deserialise(std::string_view _input, Dialect const& _dialect);
+};
+
+}
@@ -193,7 +193,7 @@ bool YulStack::analyzeParsed(Object& _object)
 
 void YulStack::compileEVM(AbstractAssembly& _assembly, bool _optimize) const
 {
-	EVMObjectCompiler::compile(*m_parserResult, _assembly, _optimize);
+	EVMObjectCompiler::compile(*m_parserResult, _assembly, _optimize, m_optimiserSettings.maxThreads);
 }
 
 void YulStack::reparse()
@@ -23,8 +23,10 @@
 
 #include <fmt/format.h>
 
+#include <deque>
 #include <unordered_map>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <string>
 #include <string_view>
@@ -35,6 +37,7 @@ namespace solidity::yul
 
 /// Repository for YulStrings.
 /// Owns the string data for all YulStrings, which can be referenced by a Handle.
+/// The strings are kept until the next reset(), which is done before each compilation.
 /// A Handle consists of an ID (that depends on the insertion order of YulStrings and is potentially
 /// non-deterministic) and a deterministic string hash.
 class YulStringRepository
@@ -54,20 +57,23 @@ public:
 
 	Handle stringToHandle(std::string_view const _string)
 	{
-		if (_string.empty())
-			return { 0, emptyHash() };
 		std::uint64_t h = hash(_string);
-		auto range = m_hashToID.equal_range(h);
-		for (auto it = range.first; it != range.second; ++it)
-			if (*m_strings[it->second] == _string)
-				return Handle{it->second, h};
-		m_strings.emplace_back(std::make_shared<std::string>(_string));
+		if (std::optional<Handle> handle = findHandle(_string, h))
+			return *handle;
+		m_strings.emplace_back(_string);
 		size_t id = m_strings.size() - 1;
-		m_hashToID.emplace_hint(range.second, std::make_pair(h, id));
+		m_hashToID.emplace(h, id);
 
 		return Handle{id, h};
 	}
-	std::string const& idToString(size_t _id) const { return *m_strings.at(_id); }
+	/// @returns the handle of @a _string if it is already in the repository, without adding it.
+	std::optional<Handle> findHandle(std::string_view const _string) const
+	{
+		return findHandle(_string, hash(_string));
+	}
+	std::string const& idToString(size_t _id) const { return m_strings.at(_id); }
+	/// @returns the number of strings in the repository, including the empty string.
+	size_t size() const { return m_strings.size(); }
 
 	static std::uint64_t hash(std::string_view const v)
 	{
@@ -91,7 +97,11 @@ public:
 		for (auto const& cb: resetCallbacks())
 			cb();
 		instance() = YulStringRepository{};
+		++generationCounter();
 	}
+	/// @returns a number that changes with every reset of the repository, i.e. whenever all
+	/// previously created YulStrings become invalid.
+	static size_t generation() { return generationCounter(); }
 	/// Struct that registers a reset callback as a side-effect of its construction.
 	/// Useful as static local variable to register a reset callback once.
 	struct ResetCallback
@@ -109,13 +119,32 @@ private:
 	YulStringRepository& operator=(YulStringRepository const& _rhs) = delete;
 	YulStringRepository& operator=(YulStringRepository&& _rhs) = default;
 
+	/// @returns the handle of @a _string, whose hash is @a _hash, if it is already in the repository.
+	std::optional<Handle> findHandle(std::string_view const _string, std::uint64_t const _hash) const
+	{
+		if (_string.empty())
+			return Handle{0, emptyHash()};
+		auto range = m_hashToID.equal_range(_hash);
+		for (auto it = range.first; it != range.second; ++it)
+			if (m_strings[it->second] == _string)
+				return Handle{it->second, _hash};
+		return std::nullopt;
+	}
+
 	static std::vector<std::function<void()>>& resetCallbacks()
 	{
 		static std::vector<std::function<void()>> callbacks;
 		return callbacks;
 	}
+	static size_t& generationCounter()
+	{
+		static size_t generation = 0;
+		return generation;
+	}
 
-	std::vector<std::shared_ptr<std::string>> m_strings = {std::make_shared<std::string>()};
+	/// Strings are stored in blocks of a deque rather than allocated individually. References
+	/// returned by idToString() stay valid when strings are added.
+	std::deque<std::string> m_strings = {std::string{}};
 	std::unordered_multimap<std::uint64_t, size_t> m_hashToID = {{emptyHash(), 0}};
 };
 
@@ -133,6 +162,14 @@ public:
 	YulString& operator=(YulString const&) = default;
 	YulString& operator=(YulString&&) = default;
 
+	/// @returns the YulString for @a _s if one was created before, without adding @a _s to the repository.
+	static std::optional<YulString> find(std::string_view const _s)
+	{
+		if (std::optional<YulStringRepository::Handle> handle = YulStringRepository::instance().findHandle(_s))
+			return YulString(*handle);
+		return std::nullopt;
+	}
+
 	/// This is not consistent with the string <-operator!
 	/// First compares the string hashes. If they are equal
 	/// it checks for identical IDs (only identical strings have
@@ -159,6 +196,8 @@ public:
 	uint64_t hash() const { return m_handle.hash; }
 
 private:
+	explicit YulString(YulStringRepository::Handle _handle): m_handle(_handle) {}
+
 	/// Handle of the string. Assumes that the empty string has ID zero.
 	YulStringRepository::Handle m_handle{ 0, YulStringRepository::emptyHash() };
 };
@@ -37,10 +37,11 @@ using namespace solidity::yul;
 void EVMObjectCompiler::compile(
 	Object const& _object,
 	AbstractAssembly& _assembly,
-	bool _optimize
+	bool _optimize,
+	size_t _maxThreads
 )
 {
-	EVMObjectCompiler compiler(_assembly);
+	EVMObjectCompiler compiler(_assembly, _maxThreads);
 	compiler.run(_object, _optimize);
 }
 
@@ -61,7 +62,7 @@ void EVMObjectCompiler::run(Object const& _object, bool _optimize)
 			auto subAssemblyAndID = m_assembly.createSubAssembly(isCreation, subObject->name);
 			context.subIDs[subObject->name] = subAssemblyAndID.second;
 			subObject->subId = subAssemblyAndID.second;
-			compile(*subObject, *subAssemblyAndID.first, _optimize);
+			compile(*subObject, *subAssemblyAndID.first, _optimize, m_maxThreads);
 		}
 		else
 		{
@@ -88,7 +89,8 @@ void EVMObjectCompiler::run(Object const& _object, bool _optimize)
 			_object.code()->root(),
 			*evmDialect,
 			context,
-			OptimizedEVMCodeTransform::UseNamedLabels::ForFirstFunctionOfEachName
+			OptimizedEVMCodeTransform::UseNamedLabels::ForFirstFunctionOfEachName,
+			m_maxThreads
 		);
 		if (!stackErrors.empty())
 		{
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <optional>
+#include <cstddef>
 #include <cstdint>
 
 namespace solidity::yul
@@ -33,17 +34,21 @@ class EVMDialect;
 class EVMObjectCompiler
 {
 public:
+	/// @param _maxThreads maximum number of threads used to generate stack layouts if @a _optimize is set,
+	/// see StackLayoutGenerator::run().
 	static void compile(
 		Object const& _object,
 		AbstractAssembly& _assembly,
-		bool _optimize
+		bool _optimize,
+		size_t _maxThreads = 0
 	);
 private:
-	EVMObjectCompiler(AbstractAssembly& _assembly): m_assembly(_assembly) {}
+	EVMObjectCompiler(AbstractAssembly& _assembly, size_t _maxThreads): m_assembly(_assembly), m_maxThreads(_maxThreads) {}
 
 	void run(Object const& _object, bool _optimize);
 
 	AbstractAssembly& m_assembly;
+	size_t m_maxThreads = 0;
 };
 
 }
@@ -44,11 +44,12 @@ std::vector<StackTooDeepError> OptimizedEVMCodeTransform::run(
 	Block const& _block,
 	EVMDialect const& _dialect,
 	BuiltinContext& _builtinContext,
-	UseNamedLabels _useNamedLabelsForFunctions
+	UseNamedLabels _useNamedLabelsForFunctions,
+	size_t _maxThreads
 )
 {
 	std::unique_ptr<CFG> dfg = ControlFlowGraphBuilder::build(_analysisInfo, _dialect, _block);
-	StackLayout stackLayout = StackLayoutGenerator::run(*dfg, !_dialect.eofVersion().has_value());
+	StackLayout stackLayout = StackLayoutGenerator::run(*dfg, !_dialect.eofVersion().has_value(), _maxThreads);
 
 	if (_dialect.eofVersion().has_value())
 	{
@@ -53,7 +53,8 @@ public:
 		Block const& _block,
 		EVMDialect const& _dialect,
 		BuiltinContext& _builtinContext,
-		UseNamedLabels _useNamedLabelsForFunctions
+		UseNamedLabels _useNamedLabelsForFunctions,
+		size_t _maxThreads = 0
 	);
 
 	/// Generate code for the function call @a _call. Only public for using with std::visit.
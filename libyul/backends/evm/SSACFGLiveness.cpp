@@ -20,7 +20,6 @@
 
 #include <libsolutil/Visitor.h>
 
-#include <range/v3/range/conversion.hpp>
 #include <range/v3/view/filter.hpp>
 #include <range/v3/view/reverse.hpp>
 
@@ -37,22 +36,23 @@ constexpr auto literalsFilter(SSACFG const& _cfg)
 }
 }
 
-std::set<SSACFG::ValueId> SSACFGLiveness::blockExitValues(SSACFG::BlockId const& _blockId) const
+SSACFGLiveness::LivenessData SSACFGLiveness::blockExitValues(SSACFG::BlockId const& _blockId) const
 {
-	std::set<SSACFG::ValueId> result;
+	LivenessData result;
 	util::GenericVisitor exitVisitor {
 		[](SSACFG::BasicBlock::MainExit const&) {},
 		[&](SSACFG::BasicBlock::FunctionReturn const& _functionReturn) {
-			result += _functionReturn.returnValues | ranges::views::filter(literalsFilter(m_cfg));
+			for (auto const& returnValue: _functionReturn.returnValues | ranges::views::filter(literalsFilter(m_cfg)))
+				result.insert(returnValue);
 		},
 		[&](SSACFG::BasicBlock::JumpTable const& _jt) {
 			if (literalsFilter(m_cfg)(_jt.value))
-				result.emplace(_jt.value);
+				result.insert(_jt.value);
 		},
 		[](SSACFG::BasicBlock::Jump const&) {},
 		[&](SSACFG::BasicBlock::ConditionalJump const& _conditionalJump) {
 			if (literalsFilter(m_cfg)(_conditionalJump.condition))
-				result.emplace(_conditionalJump.condition);
+				result.insert(_conditionalJump.condition);
 		},
 		[](SSACFG::BasicBlock::Terminated const&) {}
 	};
@@ -60,6 +60,16 @@ std::set<SSACFG::ValueId> SSACFGLiveness::blockExitValues(SSACFG::BlockId const&
 	return result;
 }
 
+void SSACFGLiveness::transferOperation(SSACFG::Operation const& _operation, LivenessData& _live) const
+{
+	// remove variables defined at p from live
+	for (auto const& output: _operation.outputs | ranges::views::filter(literalsFilter(m_cfg)))
+		_live.erase(output);
+	// add uses at p to live
+	for (auto const& input: _operation.inputs | ranges::views::filter(literalsFilter(m_cfg)))
+		_live.insert(input);
+}
+
 SSACFGLiveness::SSACFGLiveness(SSACFG const& _cfg):
 	m_cfg(_cfg),
 	m_topologicalSort(_cfg),
@@ -68,6 +78,10 @@ SSACFGLiveness::SSACFGLiveness(SSACFG const& _cfg):
 	m_liveOuts(_cfg.numBlocks()),
 	m_operationLiveOuts(_cfg.numBlocks())
 {
+	m_phis.reserve(_cfg.numBlocks());
+	for (size_t blockIdValue = 0; blockIdValue < _cfg.numBlocks(); ++blockIdValue)
+		m_phis.emplace_back(_cfg.block(SSACFG::BlockId{blockIdValue}).phis);
+
 	runDagDfs();
 	for (auto const loopRootNode: m_loopNestingForest.loopRootNodes())
 		runLoopTreeDfs(loopRootNode);
@@ -85,7 +99,7 @@ void SSACFGLiveness::runDagDfs()
 		auto const& block = m_cfg.block(blockId);
 
 		// live <- PhiUses(B)
-		std::set<SSACFG::ValueId> live{};
+		LivenessData live{};
 		block.forEachExit(
 			[&](SSACFG::BlockId const& _successor)
 			{
@@ -105,15 +119,22 @@ void SSACFGLiveness::runDagDfs()
 		block.forEachExit(
 			[&](SSACFG::BlockId const& _successor) {
 				if (!m_topologicalSort.backEdge(blockId, _successor))
-					live += m_liveIns[_successor.value] - m_cfg.block(_successor).phis;
+					live += m_liveIns[_successor.value] - m_phis[_successor.value];
 			});
 
 		if (std::holds_alternative<SSACFG::BasicBlock::FunctionReturn>(block.exit))
-			live += std::get<SSACFG::BasicBlock::FunctionReturn>(block.exit).returnValues
-					| ranges::views::filter(literalsFilter(m_cfg));
+			for (auto const& returnValue: std::get<SSACFG::BasicBlock::FunctionReturn>(block.exit).returnValues | ranges::views::filter(literalsFilter(m_cfg)))
+				live.insert(returnValue);
 
 		// clean out unreachables
-		live = live | ranges::views::filter([&](auto const& valueId) { return !std::holds_alternative<SSACFG::UnreachableValue>(m_cfg.valueInfo(valueId)); }) | ranges::to<std::set>;
+		{
+			std::vector<SSACFG::ValueId> unreachables;
+			for (auto const valueId: live)
+				if (std::holds_alternative<SSACFG::UnreachableValue>(m_cfg.valueInfo(valueId)))
+					unreachables.push_back(valueId);
+			for (auto const valueId: unreachables)
+				live.erase(valueId);
+		}
 
 		// LiveOut(B) <- live
 		m_liveOuts[blockId.value] = live;
@@ -124,16 +145,11 @@ void SSACFGLiveness::runDagDfs()
 			live += blockExitValues(blockId);
 
 			for (auto const& op: block.operations | ranges::views::reverse)
-			{
-				// remove variables defined at p from live
-				live -= op.outputs | ranges::views::filter(literalsFilter(m_cfg)) | ranges::to<std::vector>;
-				// add uses at p to live
-				live += op.inputs | ranges::views::filter(literalsFilter(m_cfg)) | ranges::to<std::vector>;
-			}
+				transferOperation(op, live);
 		}
 
 		// livein(b) <- live \cup PhiDefs(B)
-		m_liveIns[blockId.value] = live + block.phis;
+		m_liveIns[blockId.value] = live + m_phis[blockIdValue];
 	}
 }
 
@@ -142,10 +158,8 @@ void SSACFGLiveness::runLoopTreeDfs(size_t const _loopHeader)
 	// SSA Book, Algorithm 9.3
 	if (m_loopNestingForest.loopNodes().count(_loopHeader) > 0)
 	{
-		// the loop header block id
-		auto const& block = m_cfg.block(SSACFG::BlockId{_loopHeader});
 		// LiveLoop <- LiveIn(B_N) - PhiDefs(B_N)
-		auto liveLoop = m_liveIns[_loopHeader] - block.phis;
+		auto liveLoop = m_liveIns[_loopHeader] - m_phis[_loopHeader];
 		// must be live out of header if live in of children
 		m_liveOuts[_loopHeader] += liveLoop;
 		// for each blockId \in children(loopHeader)
@@ -176,8 +190,7 @@ void SSACFGLiveness::fillOperationsLiveOut()
 			for (auto const& op: operations | ranges::views::reverse)
 			{
 				*rit = live;
-				live -= op.outputs | ranges::views::filter(literalsFilter(m_cfg)) | ranges::to<std::vector>;
-				live += op.inputs | ranges::views::filter(literalsFilter(m_cfg)) | ranges::to<std::vector>;
+				transferOperation(op, live);
 				++rit;
 			}
 		}
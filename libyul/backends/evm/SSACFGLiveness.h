@@ -20,10 +20,10 @@
 
 #include <libyul/backends/evm/SSACFGLoopNestingForest.h>
 #include <libyul/backends/evm/SSACFGTopologicalSort.h>
+#include <libyul/backends/evm/SSACFGValueSet.h>
 #include <libyul/backends/evm/SSAControlFlowGraph.h>
 
 #include <cstddef>
-#include <set>
 #include <vector>
 
 namespace solidity::yul
@@ -35,7 +35,7 @@ namespace solidity::yul
 class SSACFGLiveness
 {
 public:
-	using LivenessData = std::set<SSACFG::ValueId>;
+	using LivenessData = SSACFGValueSet;
 	explicit SSACFGLiveness(SSACFG const& _cfg);
 
 	LivenessData const& liveIn(SSACFG::BlockId _blockId) const { return m_liveIns[_blockId.value]; }
@@ -47,7 +47,9 @@ private:
 	void runDagDfs();
 	void runLoopTreeDfs(size_t _loopHeader);
 	void fillOperationsLiveOut();
-	std::set<SSACFG::ValueId> blockExitValues(SSACFG::BlockId const& _blockId) const;
+	LivenessData blockExitValues(SSACFG::BlockId const& _blockId) const;
+	/// Removes the values defined by @a _operation from @a _live and adds the ones it uses.
+	void transferOperation(SSACFG::Operation const& _operation, LivenessData& _live) const;
 
 	SSACFG const& m_cfg;
 	ForwardSSACFGTopologicalSort m_topologicalSort;
@@ -55,6 +57,8 @@ private:
 	std::vector<LivenessData> m_liveIns;
 	std::vector<LivenessData> m_liveOuts;
 	std::vector<std::vector<LivenessData>> m_operationLiveOuts;
+	/// The phi values of each block.
+	std::vector<LivenessData> m_phis;
 };
 
 }
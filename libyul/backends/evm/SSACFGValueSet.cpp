@@ -0,0 +1,130 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/backends/evm/SSACFGValueSet.h>
+
+#include <algorithm>
+
+using namespace solidity::yul;
+
+size_t SSACFGValueSet::size() const
+{
+	size_t result = 0;
+	for (Word const& word: m_words)
+		result += static_cast<size_t>(std::popcount(word.bits));
+	return result;
+}
+
+bool SSACFGValueSet::contains(SSACFG::ValueId _value) const
+{
+	auto it = lowerBound(_value.value / 64);
+	return it != m_words.end() && it->index == _value.value / 64 && (it->bits >> (_value.value % 64)) & 1;
+}
+
+void SSACFGValueSet::insert(SSACFG::ValueId _value)
+{
+	size_t const index = _value.value / 64;
+	uint64_t const bit = uint64_t(1) << (_value.value % 64);
+	auto it = lowerBound(index);
+	if (it != m_words.end() && it->index == index)
+		it->bits |= bit;
+	else
+		m_words.insert(it, Word{index, bit});
+}
+
+void SSACFGValueSet::erase(SSACFG::ValueId _value)
+{
+	size_t const index = _value.value / 64;
+	auto it = lowerBound(index);
+	if (it == m_words.end() || it->index != index)
+		return;
+	it->bits &= ~(uint64_t(1) << (_value.value % 64));
+	if (it->bits == 0)
+		m_words.erase(it);
+}
+
+SSACFGValueSet& SSACFGValueSet::operator+=(SSACFGValueSet const& _other)
+{
+	if (_other.m_words.empty())
+		return *this;
+	if (m_words.empty())
+	{
+		m_words = _other.m_words;
+		return *this;
+	}
+
+	std::vector<Word> result;
+	result.reserve(m_words.size() + _other.m_words.size());
+	auto lhs = m_words.begin();
+	auto rhs = _other.m_words.begin();
+	while (lhs != m_words.end() && rhs != _other.m_words.end())
+		if (lhs->index < rhs->index)
+			result.push_back(*lhs++);
+		else if (rhs->index < lhs->index)
+			result.push_back(*rhs++);
+		else
+			result.push_back(Word{lhs->index, (lhs++)->bits | (rhs++)->bits});
+	result.insert(result.end(), lhs, m_words.end());
+	result.insert(result.end(), rhs, _other.m_words.end());
+	m_words = std::move(result);
+	return *this;
+}
+
+SSACFGValueSet& SSACFGValueSet::operator-=(SSACFGValueSet const& _other)
+{
+	// Words only ever disappear, so this can be done in place.
+	auto out = m_words.begin();
+	auto rhs = _other.m_words.begin();
+	for (Word const& word: m_words)
+	{
+		while (rhs != _other.m_words.end() && rhs->index < word.index)
+			++rhs;
+		uint64_t bits = word.bits;
+		if (rhs != _other.m_words.end() && rhs->index == word.index)
+			bits &= ~rhs->bits;
+		if (bits != 0)
+			*out++ = Word{word.index, bits};
+	}
+	m_words.erase(out, m_words.end());
+	return *this;
+}
+
+bool SSACFGValueSet::operator==(SSACFGValueSet const& _other) const
+{
+	return std::equal(
+		m_words.begin(), m_words.end(),
+		_other.m_words.begin(), _other.m_words.end(),
+		[](Word const& _lhs, Word const& _rhs) { return _lhs.index == _rhs.index && _lhs.bits == _rhs.bits; }
+	);
+}
+
+std::vector<SSACFGValueSet::Word>::iterator SSACFGValueSet::lowerBound(size_t _index)
+{
+	return std::lower_bound(
+		m_words.begin(), m_words.end(), _index,
+		[](Word const& _word, size_t _value) { return _word.index < _value; }
+	);
+}
+
+std::vector<SSACFGValueSet::Word>::const_iterator SSACFGValueSet::lowerBound(size_t _index) const
+{
+	return std::lower_bound(
+		m_words.begin(), m_words.end(), _index,
+		[](Word const& _word, size_t _value) { return _word.index < _value; }
+	);
+}
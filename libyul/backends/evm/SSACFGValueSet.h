@@ -0,0 +1,110 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <libyul/backends/evm/SSAControlFlowGraph.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace solidity::yul
+{
+
+/// Set of SSA value ids stored as a sparse bitset: a sorted list of the non-empty 64-bit words
+/// of the dense bitset indexed by ValueId::value. Values defined close to each other share a word,
+/// so unions and differences of live sets are computed a word at a time.
+class SSACFGValueSet
+{
+	struct Word
+	{
+		size_t index;
+		uint64_t bits;
+	};
+public:
+	class Iterator
+	{
+	public:
+		using iterator_concept = std::forward_iterator_tag;
+		using iterator_category = std::input_iterator_tag;
+		using value_type = SSACFG::ValueId;
+		using difference_type = std::ptrdiff_t;
+		using reference = SSACFG::ValueId;
+
+		Iterator() = default;
+		Iterator(std::vector<Word>::const_iterator _word, std::vector<Word>::const_iterator _end):
+			m_word(_word), m_end(_end), m_remainingBits(_word != _end ? _word->bits : 0) {}
+
+		SSACFG::ValueId operator*() const
+		{
+			return SSACFG::ValueId{m_word->index * 64 + static_cast<size_t>(std::countr_zero(m_remainingBits))};
+		}
+		Iterator& operator++()
+		{
+			m_remainingBits &= m_remainingBits - 1;
+			if (m_remainingBits == 0 && ++m_word != m_end)
+				m_remainingBits = m_word->bits;
+			return *this;
+		}
+		Iterator operator++(int) { Iterator result = *this; ++*this; return result; }
+		bool operator==(Iterator const& _other) const
+		{
+			return m_word == _other.m_word && m_remainingBits == _other.m_remainingBits;
+		}
+
+	private:
+		std::vector<Word>::const_iterator m_word;
+		std::vector<Word>::const_iterator m_end;
+		uint64_t m_remainingBits = 0;
+	};
+
+	SSACFGValueSet() = default;
+	template<typename Range>
+	explicit SSACFGValueSet(Range const& _values)
+	{
+		for (SSACFG::ValueId const& value: _values)
+			insert(value);
+	}
+
+	Iterator begin() const { return Iterator(m_words.begin(), m_words.end()); }
+	Iterator end() const { return Iterator(m_words.end(), m_words.end()); }
+	bool empty() const { return m_words.empty(); }
+	size_t size() const;
+	bool contains(SSACFG::ValueId _value) const;
+
+	void insert(SSACFG::ValueId _value);
+	void erase(SSACFG::ValueId _value);
+
+	SSACFGValueSet& operator+=(SSACFGValueSet const& _other);
+	SSACFGValueSet& operator-=(SSACFGValueSet const& _other);
+	friend SSACFGValueSet operator+(SSACFGValueSet _lhs, SSACFGValueSet const& _rhs) { return _lhs += _rhs; }
+	friend SSACFGValueSet operator-(SSACFGValueSet _lhs, SSACFGValueSet const& _rhs) { return _lhs -= _rhs; }
+	bool operator==(SSACFGValueSet const& _other) const;
+
+private:
+	/// @returns the first word whose index is not less than @a _index.
+	std::vector<Word>::iterator lowerBound(size_t _index);
+	std::vector<Word>::const_iterator lowerBound(size_t _index) const;
+
+	std::vector<Word> m_words;
+};
+
+}
@@ -42,17 +42,58 @@
 #include <range/v3/view/take_last.hpp>
 #include <range/v3/view/transform.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+
 using namespace solidity;
 using namespace solidity::yul;
 
-StackLayout StackLayoutGenerator::run(CFG const& _cfg, bool _simulateFunctionsWithJumps)
+StackLayout StackLayoutGenerator::run(CFG const& _cfg, bool _simulateFunctionsWithJumps, size_t _maxThreads)
 {
-	StackLayout stackLayout{{}, {}};
-	StackLayoutGenerator{stackLayout, nullptr, _simulateFunctionsWithJumps}.processEntryPoint(*_cfg.entry);
-
-	for (auto& functionInfo: _cfg.functionInfo | ranges::views::values)
-		StackLayoutGenerator{stackLayout, &functionInfo, _simulateFunctionsWithJumps}.processEntryPoint(*functionInfo.entry, &functionInfo);
+	// The layouts of the main entry point and of each function only depend on the blocks
+	// reachable from their own entry, so they are generated separately, possibly concurrently,
+	// and merged in a fixed order afterwards.
+	std::vector<CFG::FunctionInfo const*> entryPoints{nullptr};
+	for (Scope::Function const* function: _cfg.functions)
+		entryPoints.emplace_back(&_cfg.functionInfo.at(function));
+
+	std::vector<StackLayout> layouts(entryPoints.size(), StackLayout{{}, {}});
+	std::atomic<size_t> nextEntryPoint = 0;
+	auto generateLayouts = [&]() {
+		for (size_t i = nextEntryPoint++; i < entryPoints.size(); i = nextEntryPoint++)
+		{
+			CFG::FunctionInfo const* functionInfo = entryPoints[i];
+			StackLayoutGenerator{layouts[i], functionInfo, _simulateFunctionsWithJumps}.processEntryPoint(
+				functionInfo ? *functionInfo->entry : *_cfg.entry,
+				functionInfo
+			);
+		}
+	};
+	{
+		// Starting a thread only pays off if it has enough blocks to process.
+		size_t const maxThreads = _maxThreads > 0 ? _maxThreads : std::max(std::thread::hardware_concurrency(), 1u);
+		size_t const threads = std::max<size_t>(
+			std::min({maxThreads, entryPoints.size(), _cfg.blocks.size() / minBlocksPerThread}),
+			1
+		);
+		size_t const additionalThreads = threads - 1;
+		std::vector<std::future<void>> workers;
+		for (size_t i = 0; i < additionalThreads; ++i)
+			workers.emplace_back(std::async(std::launch::async, generateLayouts));
+		generateLayouts();
+		for (auto& worker: workers)
+			worker.get();
+	}
 
+	StackLayout stackLayout{{}, {}};
+	for (StackLayout& layout: layouts)
+	{
+		stackLayout.blockInfos.merge(layout.blockInfos);
+		stackLayout.operationEntryLayout.merge(layout.operationEntryLayout);
+		yulAssert(layout.blockInfos.empty() && layout.operationEntryLayout.empty(), "Block shared between functions.");
+	}
 	return stackLayout;
 }
 
@@ -55,7 +55,13 @@ public:
 		std::vector<YulName> variableChoices;
 	};
 
-	static StackLayout run(CFG const& _cfg, bool _simulateFunctionsWithJumps);
+	/// Number of blocks of the control flow graph per thread, below which run() uses fewer threads.
+	static size_t constexpr minBlocksPerThread = 128;
+
+	/// Generates the layouts of the main entry point and of the functions, using up to @a _maxThreads
+	/// threads including the calling one, or one per hardware thread if it is zero. Small graphs are
+	/// always processed on the calling thread. The result does not depend on the number of threads.
+	static StackLayout run(CFG const& _cfg, bool _simulateFunctionsWithJumps, size_t _maxThreads = 0);
 	/// @returns a map from function names to the stack too deep errors occurring in that function.
 	/// Requires @a _cfg to be a control flow graph generated from disambiguated Yul.
 	/// The empty string is mapped to the stack too deep errors of the main entry point.
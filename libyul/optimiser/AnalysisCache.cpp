@@ -0,0 +1,90 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/optimiser/AnalysisCache.h>
+
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/ControlFlowSideEffectsCollector.h>
+#include <libyul/Exceptions.h>
+
+using namespace solidity;
+using namespace solidity::yul;
+
+std::set<FunctionHandle> const& AnalysisCache::recursiveFunctions(Block const& _ast)
+{
+	use(_ast);
+	if (!m_recursiveFunctions)
+		m_recursiveFunctions = callGraph(_ast).recursiveFunctions();
+	return *m_recursiveFunctions;
+}
+
+std::map<FunctionHandle, SideEffects> const& AnalysisCache::functionSideEffects(Block const& _ast)
+{
+	use(_ast);
+	if (!m_functionSideEffects)
+		m_functionSideEffects = SideEffectsPropagator::sideEffects(m_dialect, callGraph(_ast));
+	return *m_functionSideEffects;
+}
+
+std::map<YulName, ControlFlowSideEffects> const& AnalysisCache::controlFlowSideEffects(Block const& _ast)
+{
+	use(_ast);
+	if (!m_controlFlowSideEffects)
+		m_controlFlowSideEffects = ControlFlowSideEffectsCollector{m_dialect, _ast}.functionSideEffectsNamed();
+	return *m_controlFlowSideEffects;
+}
+
+bool AnalysisCache::containsMSize(Block const& _ast)
+{
+	use(_ast);
+	if (!m_containsMSize)
+		m_containsMSize = MSizeFinder::containsMSize(m_dialect, _ast);
+	return *m_containsMSize;
+}
+
+void AnalysisCache::invalidate()
+{
+	m_ast = nullptr;
+	m_callGraph.reset();
+	m_recursiveFunctions.reset();
+	m_functionSideEffects.reset();
+	m_controlFlowSideEffects.reset();
+	m_containsMSize.reset();
+}
+
+void AnalysisCache::use(Block const& _ast)
+{
+	yulAssert(!m_ast || m_ast == &_ast, "Analysis cache used for a different AST without invalidating it.");
+	m_ast = &_ast;
+}
+
+CallGraph const& AnalysisCache::callGraph(Block const& _ast)
+{
+	if (!m_callGraph)
+		m_callGraph = CallGraphGenerator::callGraph(_ast);
+	return *m_callGraph;
+}
+
+StepAnalyses::StepAnalyses(OptimiserStepContext const& _context)
+{
+	if (_context.analyses)
+		m_cache = _context.analyses;
+	else
+		m_cache = &m_ownCache.emplace(_context.dialect);
+}
@@ -0,0 +1,102 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Analysis results about the AST shared between optimiser steps.
+ */
+
+#pragma once
+
+#include <libyul/ControlFlowSideEffects.h>
+#include <libyul/SideEffects.h>
+#include <libyul/optimiser/CallGraphGenerator.h>
+
+#include <map>
+#include <optional>
+#include <set>
+
+namespace solidity::yul
+{
+class Dialect;
+struct OptimiserStepContext;
+
+/**
+ * Caches analysis results about the AST that is being optimised, so that optimiser steps
+ * do not have to recompute them if the AST did not change in a relevant way in between.
+ *
+ * Results are computed on first use. OptimiserSuite drops them after every step that does
+ * not declare that it preserves them (see OptimiserStep::preservesAnalyses). The returned
+ * references stay valid until then.
+ *
+ * Requires unique function names.
+ */
+class AnalysisCache
+{
+public:
+	explicit AnalysisCache(Dialect const& _dialect): m_dialect(_dialect) {}
+	AnalysisCache(AnalysisCache const&) = delete;
+	AnalysisCache& operator=(AnalysisCache const&) = delete;
+
+	/// @returns the functions in @a _ast that are part of a (mutual) recursion.
+	std::set<FunctionHandle> const& recursiveFunctions(Block const& _ast);
+	/// @returns the side effects of all functions in @a _ast including the functions they call,
+	/// as computed by SideEffectsPropagator.
+	std::map<FunctionHandle, SideEffects> const& functionSideEffects(Block const& _ast);
+	/// @returns the control flow side effects of all functions in @a _ast by name.
+	std::map<YulName, ControlFlowSideEffects> const& controlFlowSideEffects(Block const& _ast);
+	/// @returns true if @a _ast contains a call to msize.
+	bool containsMSize(Block const& _ast);
+
+	/// Drops all results. Has to be called whenever the AST is modified in a way that might
+	/// change one of them.
+	void invalidate();
+
+private:
+	/// Prepares the cache for queries about @a _ast.
+	void use(Block const& _ast);
+	CallGraph const& callGraph(Block const& _ast);
+
+	Dialect const& m_dialect;
+	/// The AST the cached results belong to.
+	Block const* m_ast = nullptr;
+	std::optional<CallGraph> m_callGraph;
+	std::optional<std::set<FunctionHandle>> m_recursiveFunctions;
+	std::optional<std::map<FunctionHandle, SideEffects>> m_functionSideEffects;
+	std::optional<std::map<YulName, ControlFlowSideEffects>> m_controlFlowSideEffects;
+	std::optional<bool> m_containsMSize;
+};
+
+/**
+ * Provides the analysis cache of an optimiser step context to a step. Steps that run
+ * on their own, i.e. with a context without a cache, get a fresh cache that lives as long
+ * as this object, so that they always compute the results from scratch.
+ */
+class StepAnalyses
+{
+public:
+	explicit StepAnalyses(OptimiserStepContext const& _context);
+	StepAnalyses(StepAnalyses const&) = delete;
+	StepAnalyses& operator=(StepAnalyses const&) = delete;
+
+	AnalysisCache* operator->() { return m_cache; }
+
+private:
+	std::optional<AnalysisCache> m_ownCache;
+	AnalysisCache* m_cache = nullptr;
+};
+
+}
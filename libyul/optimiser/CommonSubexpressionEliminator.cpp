@@ -21,9 +21,9 @@
 
 #include <libyul/optimiser/CommonSubexpressionEliminator.h>
 
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/SyntacticalEquality.h>
 #include <libyul/optimiser/BlockHasher.h>
-#include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/SideEffects.h>
 #include <libyul/Exceptions.h>
@@ -37,18 +37,19 @@ using namespace solidity::util;
 
 void CommonSubexpressionEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
+	StepAnalyses analyses{_context};
 	CommonSubexpressionEliminator cse{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
+		analyses->functionSideEffects(_ast)
 	};
 	cse(_ast);
 }
 
 CommonSubexpressionEliminator::CommonSubexpressionEliminator(
 	Dialect const& _dialect,
-	std::map<FunctionHandle, SideEffects> _functionSideEffects
+	std::map<FunctionHandle, SideEffects> const& _functionSideEffects
 ):
-	DataFlowAnalyzer(_dialect, MemoryAndStorage::Ignore, std::move(_functionSideEffects))
+	DataFlowAnalyzer(_dialect, MemoryAndStorage::Ignore, &_functionSideEffects)
 {
 }
 
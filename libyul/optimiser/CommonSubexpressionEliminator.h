@@ -53,7 +53,7 @@ public:
 private:
 	CommonSubexpressionEliminator(
 		Dialect const& _dialect,
-		std::map<FunctionHandle, SideEffects> _functionSideEffects
+		std::map<FunctionHandle, SideEffects> const& _functionSideEffects
 	);
 
 protected:
@@ -53,6 +53,7 @@ class ConditionalSimplifier: public ASTModifier
 {
 public:
 	static constexpr char const* name{"ConditionalSimplifier"};
+	static constexpr bool preservesAnalyses = true;
 	static void run(OptimiserStepContext& _context, Block& _ast);
 
 	using ASTModifier::operator();
@@ -62,12 +63,12 @@ public:
 private:
 	explicit ConditionalSimplifier(
 		Dialect const& _dialect,
-		std::map<YulName, ControlFlowSideEffects> _sideEffects
+		std::map<YulName, ControlFlowSideEffects> const& _sideEffects
 	):
-		m_dialect(_dialect), m_functionSideEffects(std::move(_sideEffects))
+		m_dialect(_dialect), m_functionSideEffects(_sideEffects)
 	{}
 	Dialect const& m_dialect;
-	std::map<YulName, ControlFlowSideEffects> m_functionSideEffects;
+	std::map<YulName, ControlFlowSideEffects> const& m_functionSideEffects;
 };
 
 }
@@ -16,11 +16,11 @@
 */
 // SPDX-License-Identifier: GPL-3.0
 #include <libyul/optimiser/ConditionalUnsimplifier.h>
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/AST.h>
 #include <libyul/Utilities.h>
 #include <libyul/optimiser/NameCollector.h>
-#include <libyul/ControlFlowSideEffectsCollector.h>
 #include <libsolutil/CommonData.h>
 
 using namespace solidity;
@@ -29,9 +29,10 @@ using namespace solidity::util;
 
 void ConditionalUnsimplifier::run(OptimiserStepContext& _context, Block& _ast)
 {
+	StepAnalyses analyses{_context};
 	ConditionalUnsimplifier{
 		_context.dialect,
-		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed()
+		analyses->controlFlowSideEffects(_ast)
 	}(_ast);
 }
 
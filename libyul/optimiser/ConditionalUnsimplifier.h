@@ -33,6 +33,7 @@ class ConditionalUnsimplifier: public ASTModifier
 {
 public:
 	static constexpr char const* name{"ConditionalUnsimplifier"};
+	static constexpr bool preservesAnalyses = true;
 	static void run(OptimiserStepContext& _context, Block& _ast);
 
 	using ASTModifier::operator();
@@ -44,10 +44,10 @@ using namespace solidity::yul;
 DataFlowAnalyzer::DataFlowAnalyzer(
 	Dialect const& _dialect,
 	MemoryAndStorage _analyzeStores,
-	std::map<FunctionHandle, SideEffects> _functionSideEffects
+	std::map<FunctionHandle, SideEffects> const* _functionSideEffects
 ):
 	m_dialect(_dialect),
-	m_functionSideEffects(std::move(_functionSideEffects)),
+	m_functionSideEffects(_functionSideEffects),
 	m_knowledgeBase([this](YulName _var) { return variableValue(_var); }, _dialect),
 	m_analyzeStores(_analyzeStores == MemoryAndStorage::Analyze)
 {
@@ -246,7 +246,7 @@ void DataFlowAnalyzer::handleAssignment(std::set<YulName> const& _variables, Exp
 	if (!_isDeclaration)
 		clearValues(_variables);
 
-	MovableChecker movableChecker{m_dialect, &m_functionSideEffects};
+	MovableChecker movableChecker{m_dialect, m_functionSideEffects};
 	if (_value)
 		movableChecker.visit(*_value);
 	else
@@ -369,7 +369,7 @@ void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Block const& _block)
 {
 	if (!m_analyzeStores)
 		return;
-	SideEffectsCollector sideEffects(m_dialect, _block, &m_functionSideEffects);
+	SideEffectsCollector sideEffects(m_dialect, _block, m_functionSideEffects);
 	if (sideEffects.invalidatesStorage())
 		m_state.environment.storage.clear();
 	if (sideEffects.invalidatesMemory())
@@ -383,7 +383,7 @@ void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Expression const& _expr)
 {
 	if (!m_analyzeStores)
 		return;
-	SideEffectsCollector sideEffects(m_dialect, _expr, &m_functionSideEffects);
+	SideEffectsCollector sideEffects(m_dialect, _expr, m_functionSideEffects);
 	if (sideEffects.invalidatesStorage())
 		m_state.environment.storage.clear();
 	if (sideEffects.invalidatesMemory())
@@ -85,11 +85,12 @@ public:
 	/// @param _functionSideEffects
 	///            Side-effects of user-defined functions. Worst-case side-effects are assumed
 	///            if this is not provided or the function is not found.
-	///            The parameter is mostly used to determine movability of expressions.
+	///            The parameter is mostly used to determine movability of expressions
+	///            and has to outlive the analyzer.
 	explicit DataFlowAnalyzer(
 		Dialect const& _dialect,
 		MemoryAndStorage _analyzeStores,
-		std::map<FunctionHandle, SideEffects> _functionSideEffects = {}
+		std::map<FunctionHandle, SideEffects> const* _functionSideEffects = nullptr
 	);
 
 	using ASTModifier::operator();
@@ -165,7 +166,7 @@ protected:
 	Dialect const& m_dialect;
 	/// Side-effects of user-defined functions. Worst-case side-effects are assumed
 	/// if this is not provided or the function is not found.
-	std::map<FunctionHandle, SideEffects> m_functionSideEffects;
+	std::map<FunctionHandle, SideEffects> const* m_functionSideEffects = nullptr;
 
 private:
 	struct Environment
@@ -62,11 +62,11 @@ public:
 private:
 	DeadCodeEliminator(
 		Dialect const& _dialect,
-		std::map<YulName, ControlFlowSideEffects> _sideEffects
-	): m_dialect(_dialect), m_functionSideEffects(std::move(_sideEffects)) {}
+		std::map<YulName, ControlFlowSideEffects> const& _sideEffects
+	): m_dialect(_dialect), m_functionSideEffects(_sideEffects) {}
 
 	Dialect const& m_dialect;
-	std::map<YulName, ControlFlowSideEffects> m_functionSideEffects;
+	std::map<YulName, ControlFlowSideEffects> const& m_functionSideEffects;
 };
 
 }
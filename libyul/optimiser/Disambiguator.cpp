@@ -43,6 +43,11 @@ YulName Disambiguator::translateIdentifier(YulName _originalName)
 	return m_translations.at(id);
 }
 
+NameDispenser Disambiguator::releaseNameDispenser()
+{
+	return NameDispenser(m_dialect, std::move(m_nameDispenser).usedNames(), m_externallyUsedIdentifiers);
+}
+
 void Disambiguator::enterScope(Block const& _block)
 {
 	enterScopeInternal(*m_info.scopes.at(&_block));
@@ -47,10 +47,16 @@ public:
 		m_info(_analysisInfo),
 		m_dialect(_dialect),
 		m_externallyUsedIdentifiers(_externallyUsedIdentifiers),
-		m_nameDispenser(_dialect, m_externallyUsedIdentifiers)
+		m_nameDispenser(_dialect, std::set<YulName>{}, m_externallyUsedIdentifiers)
 	{
 	}
 
+	/// @returns a name dispenser that knows the names of all identifiers in the translated AST and
+	/// keeps the externally used identifiers reserved. Equivalent to a name dispenser initialized
+	/// with the translated AST, but does not need to collect the names again.
+	/// Can only be called once, after the translation.
+	NameDispenser releaseNameDispenser();
+
 protected:
 	void enterScope(Block const& _block) override;
 	void leaveScope(Block const& _block) override;
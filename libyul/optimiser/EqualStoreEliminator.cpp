@@ -22,7 +22,7 @@
 
 #include <libyul/optimiser/EqualStoreEliminator.h>
 
-#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/AST.h>
@@ -35,9 +35,10 @@ using namespace solidity::yul;
 
 void EqualStoreEliminator::run(OptimiserStepContext const& _context, Block& _ast)
 {
+	StepAnalyses analyses{_context};
 	EqualStoreEliminator eliminator{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
+		analyses->functionSideEffects(_ast)
 	};
 	eliminator(_ast);
 
@@ -45,9 +45,9 @@ public:
 private:
 	EqualStoreEliminator(
 		Dialect const& _dialect,
-		std::map<FunctionHandle, SideEffects> _functionSideEffects
+		std::map<FunctionHandle, SideEffects> const& _functionSideEffects
 	):
-		DataFlowAnalyzer(_dialect, MemoryAndStorage::Analyze, std::move(_functionSideEffects))
+		DataFlowAnalyzer(_dialect, MemoryAndStorage::Analyze, &_functionSideEffects)
 	{}
 
 protected:
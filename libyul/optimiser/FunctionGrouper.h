@@ -41,6 +41,7 @@ class FunctionGrouper
 {
 public:
 	static constexpr char const* name{"FunctionGrouper"};
+	static constexpr bool preservesAnalyses = true;
 	static void run(OptimiserStepContext&, Block& _ast) { FunctionGrouper{}(_ast); }
 
 	void operator()(Block& _block);
@@ -18,8 +18,8 @@
 
 #include <libyul/optimiser/FunctionSpecializer.h>
 
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/ASTCopier.h>
-#include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/NameDispenser.h>
 
@@ -128,8 +128,9 @@ FunctionDefinition FunctionSpecializer::specialize(
 
 void FunctionSpecializer::run(OptimiserStepContext& _context, Block& _ast)
 {
+	StepAnalyses analyses{_context};
 	FunctionSpecializer f{
-		CallGraphGenerator::callGraph(_ast).recursiveFunctions(),
+		analyses->recursiveFunctions(_ast),
 		_context.dispenser
 	};
 	f(_ast);
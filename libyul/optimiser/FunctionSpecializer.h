@@ -66,10 +66,10 @@ public:
 
 private:
 	explicit FunctionSpecializer(
-		std::set<FunctionHandle> _recursiveFunctions,
+		std::set<FunctionHandle> const& _recursiveFunctions,
 		NameDispenser& _nameDispenser
 	):
-		m_recursiveFunctions(std::move(_recursiveFunctions)),
+		m_recursiveFunctions(_recursiveFunctions),
 		m_nameDispenser(_nameDispenser)
 	{}
 	/// Returns a vector of Expressions, where the index `i` is an expression if the function's
@@ -101,7 +101,7 @@ private:
 	/// Note that at least one of the argument will have a literal value.
 	std::map<YulName, std::vector<std::pair<YulName, LiteralArguments>>> m_oldToNewMap;
 	/// We skip specializing recursive functions. Need backtracking to properly deal with them.
-	std::set<FunctionHandle> const m_recursiveFunctions;
+	std::set<FunctionHandle> const& m_recursiveFunctions;
 
 	NameDispenser& m_nameDispenser;
 };
@@ -22,10 +22,10 @@
 
 #include <libyul/optimiser/LoadResolver.h>
 
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/backends/evm/EVMMetrics.h>
 #include <libyul/optimiser/Semantics.h>
-#include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/SideEffects.h>
 #include <libyul/AST.h>
@@ -43,10 +43,11 @@ using namespace solidity::yul;
 
 void LoadResolver::run(OptimiserStepContext& _context, Block& _ast)
 {
-	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
+	StepAnalyses analyses{_context};
+	bool containsMSize = analyses->containsMSize(_ast);
 	LoadResolver{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
+		analyses->functionSideEffects(_ast),
 		containsMSize,
 		_context.expectedExecutionsPerDeployment
 	}(_ast);
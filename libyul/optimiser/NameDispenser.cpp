@@ -28,32 +28,58 @@
 
 #include <libsolutil/CommonData.h>
 
+#include <charconv>
+#include <limits>
+
 using namespace solidity;
 using namespace solidity::yul;
 using namespace solidity::util;
 
 NameDispenser::NameDispenser(Dialect const& _dialect, Block const& _ast, std::set<YulName> _reservedNames):
-	NameDispenser(_dialect, NameCollector(_ast).names() + _reservedNames)
+	NameDispenser(_dialect, NameCollector(_ast).names(), std::move(_reservedNames))
 {
-	m_reservedNames = std::move(_reservedNames);
 }
 
-NameDispenser::NameDispenser(Dialect const& _dialect, std::set<YulName> _usedNames):
+NameDispenser::NameDispenser(Dialect const& _dialect, std::set<YulName> _usedNames, std::set<YulName> _reservedNames):
 	m_dialect(_dialect),
-	m_usedNames(std::move(_usedNames))
+	m_usedNames(std::move(_usedNames)),
+	m_reservedNames(std::move(_reservedNames))
 {
+	m_usedNames += m_reservedNames;
 }
 
 YulName NameDispenser::newName(YulName _nameHint)
 {
-	YulName name = _nameHint;
-	while (illegalName(name))
+	if (!illegalName(_nameHint))
+	{
+		m_usedNames.emplace(_nameHint);
+		return _nameHint;
+	}
+
+	// Candidates are assembled in place, the counter is written right behind the prefix.
+	size_t constexpr maxDigits = std::numeric_limits<size_t>::digits10 + 1;
+	std::string candidate;
+	candidate.reserve(_nameHint.str().size() + 1 + maxDigits);
+	candidate.append(_nameHint.str()).push_back('_');
+	size_t const prefixLength = candidate.size();
+	while (true)
 	{
 		m_counter++;
-		name = YulName(_nameHint.str() + "_" + std::to_string(m_counter));
+		candidate.resize(prefixLength + maxDigits);
+		char* digitsEnd = std::to_chars(candidate.data() + prefixLength, candidate.data() + candidate.size(), m_counter).ptr;
+		candidate.resize(static_cast<size_t>(digitsEnd - candidate.data()));
+		if (isRestrictedIdentifier(m_dialect, candidate))
+			continue;
+
+		// Candidates that are in use are in the YulString repository already, so the candidate is
+		// only added to the repository if it is unused and returned anyway. This hashes it once.
+		YulName name{candidate};
+		if (m_usedNames.contains(name))
+			continue;
+
+		m_usedNames.emplace(name);
+		return name;
 	}
-	m_usedNames.emplace(name);
-	return name;
 }
 
 bool NameDispenser::illegalName(YulName _name)
@@ -30,6 +30,7 @@ namespace solidity::yul
 class Dialect;
 struct Block;
 class NameDispenser;
+class AnalysisCache;
 
 struct OptimiserStepContext
 {
@@ -38,6 +39,9 @@ struct OptimiserStepContext
 	std::set<YulName> const& reservedIdentifiers;
 	/// The value nullopt represents creation code
 	std::optional<size_t> expectedExecutionsPerDeployment;
+	/// Analysis results shared between steps. Only set while the steps are run by an
+	/// OptimiserSuite, which takes care of invalidating it.
+	AnalysisCache* analyses = nullptr;
 };
 
 
@@ -55,6 +59,10 @@ struct OptimiserStep
 	/// an SMT solver to be loaded, but none is available. In that case, the string
 	/// contains a human-readable reason.
 	virtual std::optional<std::string> invalidInCurrentEnvironment() const = 0;
+	/// @returns true if the step never changes the results cached in AnalysisCache,
+	/// i.e. it does not add or remove function calls or loops and does not change
+	/// which functions can terminate, revert or continue.
+	virtual bool preservesAnalyses() const = 0;
 	std::string name;
 };
 
@@ -73,6 +81,17 @@ private:
 		static constexpr bool value = decltype(test<T>(0))::value;
 	};
 
+	template<typename T>
+	struct HasPreservesAnalysesMember
+	{
+	private:
+		template<typename U> static auto test(int) -> decltype(U::preservesAnalyses, std::true_type());
+		template<typename> static std::false_type test(...);
+
+	public:
+		static constexpr bool value = decltype(test<T>(0))::value;
+	};
+
 public:
 	OptimiserStepInstance(): OptimiserStep{Step::name} {}
 	void run(OptimiserStepContext& _context, Block& _ast) const override
@@ -86,6 +105,13 @@ public:
 		else
 			return std::nullopt;
 	}
+	bool preservesAnalyses() const override
+	{
+		if constexpr (HasPreservesAnalysesMember<Step>::value)
+			return Step::preservesAnalyses;
+		else
+			return false;
+	}
 };
 
 
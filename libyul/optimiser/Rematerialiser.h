@@ -85,6 +85,7 @@ class LiteralRematerialiser: public DataFlowAnalyzer
 {
 public:
 	static constexpr char const* name{"LiteralRematerialiser"};
+	static constexpr bool preservesAnalyses = true;
 	static void run(
 		OptimiserStepContext& _context,
 		Block& _ast
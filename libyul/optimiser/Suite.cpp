@@ -21,6 +21,7 @@
 
 #include <libyul/optimiser/Suite.h>
 
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/Disambiguator.h>
 #include <libyul/optimiser/VarDeclInitializer.h>
 #include <libyul/optimiser/BlockFlattener.h>
@@ -108,18 +109,16 @@ void OptimiserSuite::run(
 		evmDialect->providesObjectAccess();
 	std::set<YulName> reservedIdentifiers = _externallyUsedIdentifiers;
 
+	Disambiguator disambiguator(dialect, *_object.analysisInfo, reservedIdentifiers);
 	Block astRoot;
 	{
 		PROFILER_PROBE("Disambiguator", probe);
-		astRoot = std::get<Block>(Disambiguator(
-			dialect,
-			*_object.analysisInfo,
-			reservedIdentifiers
-		)(_object.code()->root()));
+		astRoot = std::get<Block>(disambiguator(_object.code()->root()));
 	}
 
-	NameDispenser dispenser{dialect, astRoot, reservedIdentifiers};
-	OptimiserStepContext context{dialect, dispenser, reservedIdentifiers, _expectedExecutionsPerDeployment};
+	NameDispenser dispenser = disambiguator.releaseNameDispenser();
+	AnalysisCache analyses{dialect};
+	OptimiserStepContext context{dialect, dispenser, reservedIdentifiers, _expectedExecutionsPerDeployment, &analyses};
 
 	OptimiserSuite suite(context, Debug::None);
 
@@ -145,6 +144,7 @@ void OptimiserSuite::run(
 			_optimizeStackAllocation,
 			stackCompressorMaxIterations
 		));
+		analyses.invalidate();
 	}
 
 	// Run the user-supplied clean up sequence
@@ -153,6 +153,8 @@ void OptimiserSuite::run(
 	// and StackLimitEvader. This is hard-coded as the last step, as some previously executed steps may break the
 	// aforementioned form, thus causing the StackCompressor/StackLimitEvader to throw.
 	suite.runSequence("g", astRoot);
+	// The AST is only modified outside of optimiser steps from here on.
+	context.analyses = nullptr;
 
 	if (evmDialect)
 	{
@@ -472,10 +474,13 @@ void OptimiserSuite::runSequence(std::vector<std::string> const& _steps, Block&
 		if (m_debug == Debug::PrintStep)
 			std::cout << "Running " << step << std::endl;
 
+		OptimiserStep const& optimiserStep = *allSteps().at(step);
 		{
 			PROFILER_PROBE(step, probe);
-			allSteps().at(step)->run(m_context, _ast);
+			optimiserStep.run(m_context, _ast);
 		}
+		if (m_context.analyses && !optimiserStep.preservesAnalyses())
+			m_context.analyses->invalidate();
 
 		if (m_debug == Debug::PrintChanges)
 		{
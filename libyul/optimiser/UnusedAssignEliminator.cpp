@@ -22,6 +22,7 @@
 
 #include <libyul/optimiser/UnusedAssignEliminator.h>
 
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/ControlFlowSideEffectsCollector.h>
@@ -40,9 +41,10 @@ using namespace solidity::yul;
 
 void UnusedAssignEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
+	StepAnalyses analyses{_context};
 	UnusedAssignEliminator uae{
 		_context.dialect,
-		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed()
+		analyses->controlFlowSideEffects(_ast)
 	};
 	uae(_ast);
 
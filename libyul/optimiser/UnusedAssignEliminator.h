@@ -121,7 +121,7 @@ public:
 
 	explicit UnusedAssignEliminator(
 		Dialect const& _dialect,
-		std::map<YulName, ControlFlowSideEffects> _controlFlowSideEffects
+		std::map<YulName, ControlFlowSideEffects> const& _controlFlowSideEffects
 	):
 		UnusedStoreBase(_dialect),
 		m_controlFlowSideEffects(_controlFlowSideEffects)
@@ -144,7 +144,7 @@ private:
 	void markUsed(YulName _variable);
 
 	std::set<YulName> m_returnVariables;
-	std::map<YulName, ControlFlowSideEffects> m_controlFlowSideEffects;
+	std::map<YulName, ControlFlowSideEffects> const& m_controlFlowSideEffects;
 };
 
 }
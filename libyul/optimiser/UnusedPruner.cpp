@@ -20,6 +20,7 @@
 
 #include <libyul/optimiser/UnusedPruner.h>
 
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/FunctionGrouper.h>
 #include <libyul/optimiser/NameCollector.h>
@@ -35,7 +36,16 @@ using namespace solidity::yul;
 
 void UnusedPruner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	UnusedPruner::runUntilStabilisedOnFullAST(_context.dialect, _ast, _context.reservedIdentifiers);
+	StepAnalyses analyses{_context};
+	std::map<FunctionHandle, SideEffects> const& functionSideEffects = analyses->functionSideEffects(_ast);
+	bool allowMSizeOptimization = !analyses->containsMSize(_ast);
+	runUntilStabilised(
+		_context.dialect,
+		_ast,
+		allowMSizeOptimization,
+		&functionSideEffects,
+		_context.reservedIdentifiers
+	);
 	FunctionGrouper::run(_context, _ast);
 }
 
@@ -22,6 +22,7 @@
 
 #include <libyul/optimiser/UnusedStoreEliminator.h>
 
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/optimiser/Semantics.h>
@@ -46,10 +47,8 @@ using namespace solidity::yul;
 
 void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
-	std::map<FunctionHandle, SideEffects> functionSideEffects = SideEffectsPropagator::sideEffects(
-		_context.dialect,
-		CallGraphGenerator::callGraph(_ast)
-	);
+	StepAnalyses analyses{_context};
+	std::map<FunctionHandle, SideEffects> const& functionSideEffects = analyses->functionSideEffects(_ast);
 
 	SSAValueTracker ssaValues;
 	ssaValues(_ast);
@@ -57,11 +56,11 @@ void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 	for (auto const& [name, expression]: ssaValues.values())
 		values[name] = AssignedValue{expression, {}};
 
-	bool const ignoreMemory = MSizeFinder::containsMSize(_context.dialect, _ast);
+	bool const ignoreMemory = analyses->containsMSize(_ast);
 	UnusedStoreEliminator rse{
 		_context.dialect,
 		functionSideEffects,
-		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed(),
+		analyses->controlFlowSideEffects(_ast),
 		values,
 		ignoreMemory
 	};
@@ -83,14 +82,14 @@ void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 UnusedStoreEliminator::UnusedStoreEliminator(
 	Dialect const& _dialect,
 	std::map<FunctionHandle, SideEffects> const& _functionSideEffects,
-	std::map<YulName, ControlFlowSideEffects> _controlFlowSideEffects,
+	std::map<YulName, ControlFlowSideEffects> const& _controlFlowSideEffects,
 	std::map<YulName, AssignedValue> const& _ssaValues,
 	bool _ignoreMemory
 ):
 	UnusedStoreBase(_dialect),
 	m_ignoreMemory(_ignoreMemory),
 	m_functionSideEffects(_functionSideEffects),
-	m_controlFlowSideEffects(std::move(_controlFlowSideEffects)),
+	m_controlFlowSideEffects(_controlFlowSideEffects),
 	m_ssaValues(_ssaValues),
 	m_knowledgeBase(_ssaValues, _dialect)
 {}
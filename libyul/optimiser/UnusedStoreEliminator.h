@@ -63,7 +63,7 @@ public:
 	explicit UnusedStoreEliminator(
 		Dialect const& _dialect,
 		std::map<FunctionHandle, SideEffects> const& _functionSideEffects,
-		std::map<YulName, ControlFlowSideEffects> _controlFlowSideEffects,
+		std::map<YulName, ControlFlowSideEffects> const& _controlFlowSideEffects,
 		std::map<YulName, AssignedValue> const& _ssaValues,
 		bool _ignoreMemory
 	);
@@ -123,7 +123,7 @@ private:
 
 	bool const m_ignoreMemory;
 	std::map<FunctionHandle, SideEffects> const& m_functionSideEffects;
-	std::map<YulName, ControlFlowSideEffects> m_controlFlowSideEffects;
+	std::map<YulName, ControlFlowSideEffects> const& m_controlFlowSideEffects;
 	std::map<YulName, AssignedValue> const& m_ssaValues;
 
 	std::map<Statement const*, Operation> m_storeOperations;
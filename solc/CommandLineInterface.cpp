@@ -839,7 +839,8 @@ void CommandLineInterface::processInput()
 		solAssert(m_standardJsonInput.has_value());
 
 		StandardCompiler compiler(m_universalCallback.callback(), m_options.formatting.json);
-		sout() << compiler.compile(std::move(m_standardJsonInput.value())) << std::endl;
+		compiler.compile(m_standardJsonInput.value(), sout());
+		sout() << std::endl;
 		m_standardJsonInput.reset();
 		break;
 	}
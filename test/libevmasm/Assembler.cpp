@@ -31,6 +31,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -425,6 +426,59 @@ BOOST_AUTO_TEST_CASE(subobject_encode_decode)
 	BOOST_CHECK(assembly.decodeSubPath(assembly.encodeSubPath(subPath)) == subPath);
 }
 
+BOOST_AUTO_TEST_CASE(serial_and_concurrent_optimisation, *boost::unit_test::precondition(nonEOF()))
+{
+	EVMVersion evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	std::optional<uint8_t> eofVersion = solidity::test::CommonOptions::get().eofVersion();
+
+	// Every assembly contains code the optimiser can simplify and, up to the given depth,
+	// several sub-assemblies which are optimised concurrently unless the optimiser runs serially.
+	std::function<std::shared_ptr<Assembly>(size_t)> createAssembly = [&](size_t _depth) {
+		auto assembly = std::make_shared<Assembly>(evmVersion, _depth > 0, eofVersion, std::string{});
+		AssemblyItem loop = assembly->newTag();
+		AssemblyItem unused = assembly->newTag();
+		assembly->append(loop);
+		assembly->append(u256(_depth) + 1);
+		assembly->append(u256(2));
+		assembly->append(Instruction::ADD);
+		assembly->append(u256(0));
+		assembly->append(Instruction::MSTORE);
+		if (_depth > 0)
+			for (size_t i = 0; i < 3; ++i)
+			{
+				AssemblyItem sub = assembly->appendSubroutine(createAssembly(_depth - 1));
+				assembly->pushSubroutineOffset(static_cast<size_t>(sub.data()));
+				assembly->append(Instruction::POP);
+				assembly->append(Instruction::POP);
+			}
+		assembly->append(u256(0));
+		assembly->appendJumpI(loop);
+		assembly->append(u256(0xffffffff) << 128);
+		assembly->append(u256(0x20));
+		assembly->append(Instruction::SSTORE);
+		assembly->append(Instruction::STOP);
+		assembly->append(unused);
+		assembly->append(u256(3));
+		assembly->append(Instruction::POP);
+		assembly->append(Instruction::STOP);
+		return assembly;
+	};
+
+	Assembly::OptimiserSettings settings = Assembly::OptimiserSettings::translateSettings(OptimiserSettings::full());
+	settings.maxThreads = 1;
+	std::shared_ptr<Assembly> serial = createAssembly(2);
+	serial->optimise(settings);
+
+	for (size_t maxThreads: {size_t(0), size_t(4)})
+	{
+		settings.maxThreads = maxThreads;
+		std::shared_ptr<Assembly> concurrent = createAssembly(2);
+		concurrent->optimise(settings);
+		BOOST_CHECK_EQUAL(concurrent->assemblyString(), serial->assemblyString());
+		BOOST_CHECK_EQUAL(concurrent->assemble().toHex(), serial->assemble().toHex());
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
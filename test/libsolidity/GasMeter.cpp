@@ -340,6 +340,75 @@ BOOST_AUTO_TEST_CASE(complex_control_flow)
 	testRunTimeGas("ln(int128)", std::vector<bytes>{encodeArgs(0), encodeArgs(10), encodeArgs(105), encodeArgs(30000)});
 }
 
+BOOST_AUTO_TEST_CASE(reused_meters_match_fresh_meters)
+{
+	char const* sourceCode = R"(
+		contract test {
+			uint data;
+			uint[] values;
+			function f(uint a) public returns (uint) {
+				if (a > 7)
+					data = a;
+				else
+					values.push(a);
+				return g(a) + data;
+			}
+			function g(uint b) internal view returns (uint r) {
+				r = b;
+				for (uint i = 0; i < values.length; ++i)
+					r += values[i];
+			}
+			function h(uint a, uint b) internal pure returns (uint) { return a * b + 3; }
+			function k(uint a, uint b) public pure returns (uint) { return h(a, b) + h(b, a); }
+		}
+	)";
+	compile(sourceCode);
+	EVMVersion const evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	std::string const contractName = m_compiler.lastContractName();
+
+	// Estimating repeatedly with the same meter yields the same results as estimating with fresh meters.
+	for (AssemblyItems const* items: {m_compiler.assemblyItems(contractName), m_compiler.runtimeAssemblyItems(contractName)})
+	{
+		BOOST_REQUIRE(items);
+		PathGasMeter sharedMeter(*items, evmVersion);
+		for (size_t run = 0; run < 2; ++run)
+			for (size_t index = 0; index < items->size(); ++index)
+				if (index == 0 || items->at(index).type() == Tag)
+				{
+					auto state = std::make_shared<KnownState>();
+					GasMeter::GasConsumption reused = sharedMeter.estimateMax(index, state);
+					GasMeter::GasConsumption fresh = PathGasMeter(*items, evmVersion).estimateMax(index, state);
+					BOOST_CHECK_EQUAL(reused.isInfinite, fresh.isInfinite);
+					BOOST_CHECK_EQUAL(reused.value, fresh.value);
+				}
+	}
+
+	// The same holds for the estimates by function, which are cached.
+	AssemblyItems const& runtimeItems = *m_compiler.runtimeAssemblyItems(contractName);
+	GasEstimator sharedEstimator(evmVersion);
+	for (size_t run = 0; run < 2; ++run)
+	{
+		for (std::string const signature: {"f(uint256)", "k(uint256,uint256)", "INVALID", ""})
+		{
+			GasEstimator::GasConsumption reused = sharedEstimator.functionalEstimation(runtimeItems, signature);
+			GasEstimator::GasConsumption fresh = GasEstimator(evmVersion).functionalEstimation(runtimeItems, signature);
+			BOOST_CHECK_EQUAL(reused.isInfinite, fresh.isInfinite);
+			BOOST_CHECK_EQUAL(reused.value, fresh.value);
+		}
+		// Every tag is used as the entry point of every function here, so that functions
+		// with the same number of parameters share the cached estimates.
+		for (FunctionDefinition const* function: m_compiler.contractDefinition(contractName).definedFunctions())
+			for (size_t entry = 1; entry < runtimeItems.size(); ++entry)
+				if (runtimeItems.at(entry).type() == Tag)
+				{
+					GasEstimator::GasConsumption reused = sharedEstimator.functionalEstimation(runtimeItems, entry, *function);
+					GasEstimator::GasConsumption fresh = GasEstimator(evmVersion).functionalEstimation(runtimeItems, entry, *function);
+					BOOST_CHECK_EQUAL(reused.isInfinite, fresh.isInfinite);
+					BOOST_CHECK_EQUAL(reused.value, fresh.value);
+				}
+	}
+}
+
 BOOST_AUTO_TEST_CASE(
 	mcopy_memory_expansion_gas,
 	*boost::unit_test::precondition(minEVMVersionCheck(EVMVersion::cancun()))
@@ -178,6 +178,36 @@ BOOST_AUTO_TEST_CASE(with_callback)
 	BOOST_CHECK(containsError(result, "ParserError", "Source \"notfound.sol\" not found: Callback not supported."));
 }
 
+BOOST_AUTO_TEST_CASE(reuse_optimized_objects)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"fileA": {
+				"content": "contract A { function f(uint x) public pure returns (uint) { return x * 7 + 1; } }"
+			}
+		},
+		"settings": {
+			"viaIR": true,
+			"optimizer": { "enabled": true },
+			"outputSelection": { "*": { "*": ["evm.bytecode.object", "evm.deployedBytecode.object", "irOptimized"] } }
+		}
+	}
+	)";
+	Json expected = compile(input);
+	BOOST_REQUIRE(expected.contains("contracts"));
+
+	solidity_set_reuse_optimized_objects(true);
+	Json first = compile(input);
+	Json second = compile(input);
+	solidity_set_reuse_optimized_objects(false);
+
+	BOOST_CHECK_EQUAL(first.dump(), expected.dump());
+	BOOST_CHECK_EQUAL(second.dump(), expected.dump());
+	BOOST_CHECK_EQUAL(compile(input).dump(), expected.dump());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
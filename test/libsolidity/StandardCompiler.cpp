@@ -28,6 +28,7 @@
 #include <libsolidity/interface/Version.h>
 #include <libsolutil/JSON.h>
 #include <libsolutil/CommonData.h>
+#include <libyul/YulString.h>
 #include <test/Metadata.h>
 #include <test/Common.h>
 
@@ -2290,6 +2291,143 @@ BOOST_AUTO_TEST_CASE(ethdebug_ethdebug_output)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(ir_independent_of_other_contracts)
+{
+	// Both contracts request the same helper functions, but with different argument expressions.
+	std::string const sourceA = R"(
+		pragma solidity >=0.0;
+		error E(uint);
+		contract A {
+			function f(bool c, string memory s, uint x) public pure returns (uint) {
+				require(c, s);
+				require(c, E(x));
+				return x + 1;
+			}
+		}
+	)";
+	std::string const sourceB = R"(
+		pragma solidity >=0.0;
+		import "A.sol";
+		contract B {
+			function g(uint y, bool d, string memory t) public pure returns (uint) {
+				require(d, t);
+				require(d, E(y));
+				assert(y > 2);
+				return y + 2;
+			}
+		}
+	)";
+	auto input = [&](Json const& _outputSelection) {
+		return Json{
+			{"language", "Solidity"},
+			{"sources", {
+				{"A.sol", {{"content", sourceA}}},
+				{"B.sol", {{"content", sourceB}}}
+			}},
+			{"settings", {{"outputSelection", _outputSelection}}}
+		};
+	};
+
+	frontend::StandardCompiler compiler;
+	Json resultAll = compiler.compile(input({{"*", {{"*", Json::array({"ir"})}}}}));
+	BOOST_REQUIRE(containsAtMostWarnings(resultAll));
+	Json resultB = compiler.compile(input({{"B.sol", {{"B", Json::array({"ir"})}}}}));
+	BOOST_REQUIRE(containsAtMostWarnings(resultB));
+
+	BOOST_REQUIRE(getContractResult(resultAll, "A.sol", "A")["ir"].is_string());
+	BOOST_REQUIRE(getContractResult(resultB, "B.sol", "B")["ir"].is_string());
+	BOOST_CHECK_EQUAL(
+		getContractResult(resultAll, "B.sol", "B")["ir"].get<std::string>(),
+		getContractResult(resultB, "B.sol", "B")["ir"].get<std::string>()
+	);
+}
+
+BOOST_AUTO_TEST_CASE(ir_of_shared_helpers_independent_of_call_site)
+{
+	// Both contracts use the same reusable helpers (ABI coding, storage and literal copies, checked
+	// arithmetic), but from call sites with different variable names, types and surrounding helpers.
+	std::string const source = R"(
+		pragma solidity >=0.0;
+		contract A {
+			struct S { uint a; bytes b; }
+			S s;
+			event Ev(uint[] x, string y);
+			function f(uint[] calldata x, string memory y) public returns (bytes memory) {
+				s.b = bytes(y);
+				emit Ev(x, "a string literal that is longer than thirty-two bytes");
+				return abi.encode(x, y, s.a + x.length);
+			}
+		}
+		contract B {
+			event Ev(uint[] v, string w);
+			mapping(uint => bytes) m;
+			function g(string memory w, uint[] calldata v) public returns (uint, bytes memory) {
+				m[v.length] = bytes(w);
+				emit Ev(v, "a string literal that is longer than thirty-two bytes");
+				return (v.length * 7, abi.encode(w, v));
+			}
+		}
+	)";
+	auto input = [&](Json const& _outputSelection) {
+		return Json{
+			{"language", "Solidity"},
+			{"sources", {{"A.sol", {{"content", source}}}}},
+			{"settings", {{"outputSelection", _outputSelection}}}
+		};
+	};
+
+	frontend::StandardCompiler compiler;
+	Json resultAll = compiler.compile(input({{"*", {{"*", Json::array({"ir"})}}}}));
+	BOOST_REQUIRE(containsAtMostWarnings(resultAll));
+	for (std::string const contractName: {"A", "B"})
+	{
+		// Compile every contract on its own as well, so that it generates all helpers itself.
+		Json resultSingle = frontend::StandardCompiler{}.compile(input({{"A.sol", {{contractName, Json::array({"ir"})}}}}));
+		BOOST_REQUIRE(containsAtMostWarnings(resultSingle));
+		BOOST_REQUIRE(getContractResult(resultSingle, "A.sol", contractName)["ir"].is_string());
+		BOOST_CHECK_EQUAL(
+			getContractResult(resultAll, "A.sol", contractName)["ir"].get<std::string>(),
+			getContractResult(resultSingle, "A.sol", contractName)["ir"].get<std::string>()
+		);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(reuse_optimized_objects_bounds_yul_strings)
+{
+	// Every compilation introduces new names, which accumulate in the YulStringRepository
+	// as long as optimized objects are reused.
+	auto input = [](size_t _index) {
+		std::string const name = "C" + std::to_string(_index);
+		return Json{
+			{"language", "Solidity"},
+			{"sources", {{"A.sol", {{"content",
+				"contract " + name + " { function f" + name + "(uint x) public pure returns (uint) { return x * 3; } }"
+			}}}}},
+			{"settings", {
+				{"viaIR", true},
+				{"optimizer", {{"enabled", true}}},
+				{"outputSelection", {{"A.sol", {{name, Json::array({"evm.bytecode.object"})}}}}}
+			}}
+		};
+	};
+
+	frontend::StandardCompiler referenceCompiler;
+	BOOST_REQUIRE(containsAtMostWarnings(referenceCompiler.compile(input(0))));
+	size_t const stringsPerCompilation = yul::YulStringRepository::instance().size();
+
+	frontend::StandardCompiler compiler;
+	compiler.setReuseOptimizedObjects(true, stringsPerCompilation + 1);
+	size_t const generation = yul::YulStringRepository::generation();
+	for (size_t i = 1; i <= 10; ++i)
+	{
+		Json result = compiler.compile(input(i));
+		BOOST_REQUIRE(containsAtMostWarnings(result));
+		BOOST_CHECK(getContractResult(result, "A.sol", "C" + std::to_string(i))["evm"]["bytecode"]["object"].is_string());
+		BOOST_CHECK_LE(yul::YulStringRepository::instance().size(), 2 * stringsPerCompilation + 1);
+	}
+	BOOST_CHECK(yul::YulStringRepository::generation() != generation);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -0,0 +1,73 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/CopyOnWrite.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <vector>
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(CopyOnWriteTests, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(default_constructed_is_empty)
+{
+	CopyOnWrite<std::vector<int>> value;
+	BOOST_CHECK(value->empty());
+	BOOST_CHECK(&*value == &*CopyOnWrite<std::vector<int>>{});
+}
+
+BOOST_AUTO_TEST_CASE(copies_share_value_until_modified)
+{
+	CopyOnWrite<std::vector<int>> value{std::vector<int>{1, 2, 3}};
+	CopyOnWrite<std::vector<int>> copy = value;
+	BOOST_CHECK(&*value == &*copy);
+
+	copy.mutate().push_back(4);
+	BOOST_CHECK(&*value != &*copy);
+	BOOST_CHECK(*value == (std::vector<int>{1, 2, 3}));
+	BOOST_CHECK(*copy == (std::vector<int>{1, 2, 3, 4}));
+
+	// Neither value is shared anymore, so modifying it does not copy.
+	std::vector<int> const* original = &*value;
+	value.mutate().push_back(5);
+	BOOST_CHECK(&*value == original);
+	BOOST_CHECK(*value == (std::vector<int>{1, 2, 3, 5}));
+	BOOST_CHECK(*copy == (std::vector<int>{1, 2, 3, 4}));
+}
+
+BOOST_AUTO_TEST_CASE(reset_does_not_affect_copies)
+{
+	CopyOnWrite<std::map<int, int>> value;
+	value.mutate()[1] = 2;
+	CopyOnWrite<std::map<int, int>> copy = value;
+	value.reset();
+	BOOST_CHECK(value->empty());
+	BOOST_CHECK(*copy == (std::map<int, int>{{1, 2}}));
+
+	value.mutate()[3] = 4;
+	BOOST_CHECK(*value == (std::map<int, int>{{3, 4}}));
+	BOOST_CHECK(*copy == (std::map<int, int>{{1, 2}}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
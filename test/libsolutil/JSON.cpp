@@ -26,6 +26,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <sstream>
+
 
 namespace solidity::util::test
 {
@@ -117,6 +119,49 @@ BOOST_AUTO_TEST_CASE(json_compact_print)
 	BOOST_CHECK(R"({"1":1,"2":"2","3":{"3.1":"3.1","3.2":2},"4":"\u0911 \u0912 \u0913 \u0914 \u0915 \u0916","5":"\u0010","6":"\u4e2d"})" == jsonCompactPrint(json));
 }
 
+BOOST_AUTO_TEST_CASE(json_stream_writer)
+{
+	Json json;
+	json["a"] = 1;
+	json["b"]["x"]["1"] = "ऑ";
+	json["b"]["x"]["2"] = Json::array({1, Json::object({{"k", "v"}})});
+	json["b"]["y"] = Json::object();
+	json["c"] = "c\n";
+
+	for (JsonFormat format: {JsonFormat{JsonFormat::Compact}, JsonFormat{JsonFormat::Pretty}, JsonFormat{JsonFormat::Pretty, 4}})
+	{
+		std::ostringstream output;
+		JsonStreamWriter writer(output, format);
+		writer.write({"a"}, json["a"]);
+		writer.write({"b", "x", "1"}, json["b"]["x"]["1"]);
+		writer.write({"b", "x", "2"}, json["b"]["x"]["2"]);
+		writer.write({"b", "y"}, json["b"]["y"]);
+		writer.write({"c"}, json["c"]);
+		writer.finish();
+		BOOST_CHECK(!writer.failed());
+		BOOST_CHECK_EQUAL(output.str(), jsonPrint(json, format));
+	}
+
+	std::ostringstream output;
+	JsonStreamWriter writer(output, JsonFormat{});
+	BOOST_CHECK(writer.empty());
+	writer.write({"b"}, 1);
+	BOOST_CHECK(!writer.empty());
+	BOOST_CHECK_THROW(writer.write({"a"}, 1), Exception);
+	writer.write({"c"}, "\xff");
+	BOOST_CHECK(writer.failed());
+	// Errors are appended regardless of the key order, but only if they can be serialised.
+	BOOST_CHECK_THROW(writer.finish("a", "\xff"), Json::exception);
+	writer.finish("a", Json::array({"error"}));
+	BOOST_CHECK_EQUAL(output.str(), R"({"b":1,"a":["error"]})");
+
+	std::ostringstream nestedOutput;
+	JsonStreamWriter nestedWriter(nestedOutput, JsonFormat{JsonFormat::Pretty});
+	nestedWriter.write({"b", "x"}, 1);
+	nestedWriter.finish("b", Json::object({{"y", 2}}));
+	BOOST_CHECK_EQUAL(nestedOutput.str(), "{\n  \"b\": {\n    \"x\": 1\n  },\n  \"b\": {\n    \"y\": 2\n  }\n}");
+}
+
 BOOST_AUTO_TEST_CASE(parse_json_strict)
 {
 	// In this test we check conformance against JSON.parse (https://tc39.es/ecma262/multipage/structured-data.html#sec-json.parse)
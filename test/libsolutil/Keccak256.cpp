@@ -68,6 +68,26 @@ BOOST_AUTO_TEST_CASE(strings)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(many)
+{
+	std::vector<std::string> inputs{"", "test", "longer test string", std::string(135, 'a'), std::string(136, 'a')};
+	for (size_t length: std::vector<size_t>{0, 1, 135, 136, 137, 271, 272, 300})
+		inputs.emplace_back(length, 'x');
+	std::vector<bytesConstRef> refs;
+	for (std::string const& input: inputs)
+		refs.emplace_back(input);
+
+	std::vector<h256> hashes = keccak256Many(refs);
+	BOOST_REQUIRE_EQUAL(hashes.size(), inputs.size());
+	for (size_t i = 0; i < inputs.size(); ++i)
+		BOOST_CHECK_EQUAL(hashes[i], keccak256(inputs[i]));
+	BOOST_CHECK_EQUAL(
+		hashes[1],
+		FixedHash<32>("0x9c22ff5f21f0b81b113e63f7db6da94fedef11b2119b4088b89664fb9a3cb658")
+	);
+	BOOST_CHECK(keccak256Many({}).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
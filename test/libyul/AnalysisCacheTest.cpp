@@ -0,0 +1,188 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the analysis results shared between Yul optimiser steps.
+ */
+
+#include <test/libyul/Common.h>
+
+#include <libyul/optimiser/AnalysisCache.h>
+#include <libyul/optimiser/Disambiguator.h>
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/Suite.h>
+#include <libyul/AST.h>
+#include <libyul/Object.h>
+#include <libyul/YulStack.h>
+
+#include <boost/test/unit_test.hpp>
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+std::vector<std::string> const sources{
+	R"({
+		function recursive(a) -> r {
+			if a { r := add(recursive(sub(a, 1)), mload(a)) }
+		}
+		function even(n) -> r {
+			r := 1
+			if n { r := odd(sub(n, 1)) }
+		}
+		function odd(n) -> r {
+			if n { r := even(sub(n, 1)) }
+		}
+		function reverts(a) {
+			if iszero(a) { revert(0, 0) }
+			revert(a, a)
+		}
+		function terminates(a) -> r {
+			switch a
+			case 0 { return(0, 0) }
+			default { r := add(a, msize()) }
+		}
+		function sum(a, b) -> r {
+			let x := add(a, b)
+			r := mul(x, x)
+		}
+		function stores(a) {
+			for { let i := 0 } lt(i, a) { i := add(i, 1) } {
+				sstore(i, sum(i, sload(i)))
+				if eq(i, 7) { break }
+			}
+			mstore(a, keccak256(0, a))
+		}
+		let x := recursive(calldataload(0))
+		stores(add(even(x), odd(calldataload(32))))
+		if lt(x, 3) { reverts(x) }
+		sstore(0, terminates(sum(x, 2)))
+	})",
+	R"({
+		function f(a) -> r {
+			let b := add(a, 1)
+			if gt(b, 10) { leave }
+			r := g(b)
+		}
+		function g(a) -> r {
+			r := a
+			for { } lt(r, 100) { r := add(r, a) } {
+				if eq(r, 42) { continue }
+				mstore(r, f(r))
+			}
+		}
+		function h() { invalid() }
+		let y := f(calldataload(0))
+		switch y
+		case 0 { h() }
+		default { sstore(y, g(y)) }
+	})"
+};
+
+bool sameControlFlowSideEffects(
+	std::map<YulName, ControlFlowSideEffects> const& _lhs,
+	std::map<YulName, ControlFlowSideEffects> const& _rhs
+)
+{
+	if (_lhs.size() != _rhs.size())
+		return false;
+	for (auto const& [name, sideEffects]: _lhs)
+	{
+		auto it = _rhs.find(name);
+		if (
+			it == _rhs.end() ||
+			it->second.canTerminate != sideEffects.canTerminate ||
+			it->second.canRevert != sideEffects.canRevert ||
+			it->second.canContinue != sideEffects.canContinue
+		)
+			return false;
+	}
+	return true;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulAnalysisCache)
+
+BOOST_AUTO_TEST_CASE(preserving_steps_keep_cached_analyses)
+{
+	// The code is brought into the shape other steps expect first, and also into SSA form
+	// with split expressions, so that steps like the SSAReverser and the ExpressionJoiner have work to do.
+	for (std::string_view preparation: {"hgfo", "hgfoxa"})
+		for (std::string const& source: sources)
+			for (auto const& [name, step]: OptimiserSuite::allSteps())
+			{
+				if (!step->preservesAnalyses())
+					continue;
+				BOOST_TEST_CONTEXT(name << " after " << preparation)
+				{
+					YulStack yulStack = parseYul(source);
+					BOOST_REQUIRE(!yulStack.hasErrors());
+					Object const& object = *yulStack.parserResult();
+					Dialect const& dialect = *object.dialect();
+
+					std::set<YulName> reservedIdentifiers;
+					Disambiguator disambiguator(dialect, *object.analysisInfo, reservedIdentifiers);
+					Block ast = std::get<Block>(disambiguator(object.code()->root()));
+					NameDispenser dispenser = disambiguator.releaseNameDispenser();
+					AnalysisCache analyses{dialect};
+					OptimiserStepContext context{dialect, dispenser, reservedIdentifiers, 200, &analyses};
+					OptimiserSuite{context}.runSequence(preparation, ast);
+
+					// Fill the cache before running the step.
+					analyses.recursiveFunctions(ast);
+					analyses.functionSideEffects(ast);
+					analyses.controlFlowSideEffects(ast);
+					analyses.containsMSize(ast);
+					step->run(context, ast);
+
+					AnalysisCache fresh{dialect};
+					BOOST_CHECK(analyses.recursiveFunctions(ast) == fresh.recursiveFunctions(ast));
+					BOOST_CHECK(analyses.functionSideEffects(ast) == fresh.functionSideEffects(ast));
+					BOOST_CHECK(sameControlFlowSideEffects(analyses.controlFlowSideEffects(ast), fresh.controlFlowSideEffects(ast)));
+					BOOST_CHECK_EQUAL(analyses.containsMSize(ast), fresh.containsMSize(ast));
+				}
+			}
+}
+
+BOOST_AUTO_TEST_CASE(results_are_computed_once)
+{
+	YulStack yulStack = parseYul(sources.front());
+	BOOST_REQUIRE(!yulStack.hasErrors());
+	Object const& object = *yulStack.parserResult();
+	Dialect const& dialect = *object.dialect();
+	Disambiguator disambiguator(dialect, *object.analysisInfo);
+	Block ast = std::get<Block>(disambiguator(object.code()->root()));
+
+	AnalysisCache analyses{dialect};
+	auto const& sideEffects = analyses.functionSideEffects(ast);
+	BOOST_CHECK_EQUAL(&analyses.functionSideEffects(ast), &sideEffects);
+	BOOST_CHECK_EQUAL(&analyses.recursiveFunctions(ast), &analyses.recursiveFunctions(ast));
+	BOOST_CHECK_EQUAL(&analyses.controlFlowSideEffects(ast), &analyses.controlFlowSideEffects(ast));
+	BOOST_CHECK(analyses.containsMSize(ast));
+
+	analyses.invalidate();
+	Block otherAst = std::get<Block>(Disambiguator(dialect, *object.analysisInfo)(object.code()->root()));
+	BOOST_CHECK_EQUAL(analyses.recursiveFunctions(otherAst).size(), size_t(3));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
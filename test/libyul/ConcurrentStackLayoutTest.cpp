@@ -0,0 +1,109 @@
+/*
+    This file is part of solidity.
+
+    solidity is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    solidity is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests checking that stack layouts generated concurrently match the serially generated ones.
+ */
+
+#include <test/libyul/Common.h>
+
+#include <libyul/backends/evm/ControlFlowGraph.h>
+#include <libyul/backends/evm/ControlFlowGraphBuilder.h>
+#include <libyul/backends/evm/StackLayoutGenerator.h>
+#include <libyul/Object.h>
+#include <libyul/YulStack.h>
+
+#include <boost/test/unit_test.hpp>
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+/// @returns Yul code with @a _functions functions of @a _branches branches each.
+std::string manyFunctions(size_t _functions, size_t _branches)
+{
+	std::string source = "{\n";
+	for (size_t function = 0; function < _functions; ++function)
+	{
+		std::string const name = "f" + std::to_string(function);
+		source += "function " + name + "(a, b, c) -> r, s {\n\tr := a\n";
+		for (size_t branch = 0; branch < _branches; ++branch)
+			source +=
+				"\tif lt(a, " + std::to_string(branch) + ") { r := add(r, b) s := mul(s, c) }\n"
+				"\tswitch mod(b, " + std::to_string(branch + 2) + ") case 0 { s := sub(s, r) } default { r := xor(r, c) }\n";
+		source += "}\n";
+		source += "{ let x, y := " + name + "(calldataload(0), calldataload(32), calldataload(64)) sstore(x, y) }\n";
+	}
+	return source + "}\n";
+}
+
+void checkSameLayout(StackLayout const& _lhs, StackLayout const& _rhs)
+{
+	BOOST_REQUIRE_EQUAL(_lhs.blockInfos.size(), _rhs.blockInfos.size());
+	for (auto const& [block, info]: _lhs.blockInfos)
+	{
+		StackLayout::BlockInfo const& other = _rhs.blockInfos.at(block);
+		BOOST_CHECK(info.entryLayout == other.entryLayout);
+		BOOST_CHECK(info.exitLayout == other.exitLayout);
+	}
+	BOOST_REQUIRE_EQUAL(_lhs.operationEntryLayout.size(), _rhs.operationEntryLayout.size());
+	for (auto const& [operation, layout]: _lhs.operationEntryLayout)
+		BOOST_CHECK(layout == _rhs.operationEntryLayout.at(operation));
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulConcurrentStackLayout)
+
+BOOST_AUTO_TEST_CASE(concurrent_matches_serial)
+{
+	YulStack yulStack = parseYul(manyFunctions(24, 16));
+	BOOST_REQUIRE(!yulStack.hasErrors());
+	std::unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(
+		*yulStack.parserResult()->analysisInfo,
+		yulStack.dialect(),
+		yulStack.parserResult()->code()->root()
+	);
+	// Large enough for run() to use several threads.
+	BOOST_REQUIRE_GE(cfg->blocks.size(), 4 * StackLayoutGenerator::minBlocksPerThread);
+
+	for (bool simulateFunctionsWithJumps: {true, false})
+	{
+		StackLayout serial = StackLayoutGenerator::run(*cfg, simulateFunctionsWithJumps, 1);
+		checkSameLayout(StackLayoutGenerator::run(*cfg, simulateFunctionsWithJumps, 4), serial);
+		checkSameLayout(StackLayoutGenerator::run(*cfg, simulateFunctionsWithJumps, 0), serial);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(small_graph)
+{
+	YulStack yulStack = parseYul(manyFunctions(2, 1));
+	BOOST_REQUIRE(!yulStack.hasErrors());
+	std::unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(
+		*yulStack.parserResult()->analysisInfo,
+		yulStack.dialect(),
+		yulStack.parserResult()->code()->root()
+	);
+	BOOST_REQUIRE_LT(cfg->blocks.size(), StackLayoutGenerator::minBlocksPerThread);
+	checkSameLayout(StackLayoutGenerator::run(*cfg, true, 4), StackLayoutGenerator::run(*cfg, true, 1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,136 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the NameDispenser.
+ */
+
+#include <test/Common.h>
+#include <test/libyul/Common.h>
+
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/optimiser/Disambiguator.h>
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/AST.h>
+#include <libyul/Object.h>
+#include <libyul/YulStack.h>
+
+#include <boost/test/unit_test.hpp>
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+Dialect const& dialect()
+{
+	return EVMDialect::strictAssemblyForEVM(
+		solidity::test::CommonOptions::get().evmVersion(),
+		solidity::test::CommonOptions::get().eofVersion()
+	);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulNameDispenser)
+
+BOOST_AUTO_TEST_CASE(released_names_match_disambiguated_ast)
+{
+	YulStack yulStack = parseYul(R"({
+		function f(a, b) -> r {
+			{ let x := add(a, b) r := x }
+			{ let x := mul(a, b) r := add(r, x) }
+			r := g(r)
+		}
+		function g(a) -> r { let x := a r := x }
+		let v := f(1, 2)
+		{ let x := v let a := x sstore(a, v) }
+		for { let i := 0 } lt(i, v) { i := add(i, 1) } { let x := i sstore(x, i) }
+		let external := 7
+		function h() -> x { x := external_1() }
+		function external_1() -> y { y := 1 }
+		sstore(external, h())
+	})");
+	BOOST_REQUIRE(!yulStack.hasErrors());
+	Object const& object = *yulStack.parserResult();
+	std::set<YulName> const reserved{YulName{"external"}, YulName{"unusedReserved"}};
+
+	Disambiguator disambiguator(*object.dialect(), *object.analysisInfo, reserved);
+	Block ast = std::get<Block>(disambiguator(object.code()->root()));
+	NameDispenser released = disambiguator.releaseNameDispenser();
+	NameDispenser collected{*object.dialect(), ast, reserved};
+
+	BOOST_CHECK(released.usedNames() == collected.usedNames());
+	BOOST_CHECK(released.usedNames().contains(YulName{"unusedReserved"}));
+	BOOST_CHECK(released.usedNames().contains(YulName{"x_1"}));
+
+	// Both hand out the same names from here on, also after resetting them.
+	for (size_t run = 0; run < 2; ++run)
+	{
+		for (std::string hint: {"x", "y", "i", "f", "external", "add", "z"})
+			BOOST_CHECK_EQUAL(released.newName(YulName{hint}).str(), collected.newName(YulName{hint}).str());
+		BOOST_CHECK(released.usedNames() == collected.usedNames());
+		released.reset(ast);
+		collected.reset(ast);
+		BOOST_CHECK(released.usedNames().contains(YulName{"unusedReserved"}));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(new_name_retries)
+{
+	NameDispenser dispenser{dialect(), std::set<YulName>{YulName{"x"}, YulName{"x_1"}, YulName{"x_2"}, YulName{"y_4"}}};
+
+	// Unused hints are returned as they are.
+	BOOST_CHECK_EQUAL(dispenser.newName(YulName{"y"}).str(), "y");
+	// The counter is shared between all hints and skips used candidates.
+	BOOST_CHECK_EQUAL(dispenser.newName(YulName{"x"}).str(), "x_3");
+	BOOST_CHECK_EQUAL(dispenser.newName(YulName{"y"}).str(), "y_5");
+	BOOST_CHECK_EQUAL(dispenser.newName(YulName{"x"}).str(), "x_6");
+	// Builtins and keywords cannot be used as names.
+	BOOST_CHECK_EQUAL(dispenser.newName(YulName{"add"}).str(), "add_7");
+	BOOST_CHECK_EQUAL(dispenser.newName(YulName{"let"}).str(), "let_8");
+	// Names that exist, but are not in use, are handed out.
+	YulName const existing{"z_9"};
+	dispenser.markUsed(YulName{"z"});
+	BOOST_CHECK(dispenser.newName(YulName{"z"}) == existing);
+	// Names marked as used later are skipped as well.
+	dispenser.markUsed(YulName{"x_10"});
+	BOOST_CHECK_EQUAL(dispenser.newName(YulName{"x"}).str(), "x_11");
+
+	for (std::string name: {"x", "x_3", "y", "y_5", "x_6", "add_7", "let_8", "z", "z_9", "x_10", "x_11"})
+		BOOST_CHECK(dispenser.illegalName(YulName{name}));
+	BOOST_CHECK(!dispenser.illegalName(YulName{"x_12"}));
+
+	// Resetting restarts the counter and keeps only the names used in the AST.
+	dispenser.reset(Block{});
+	BOOST_CHECK_EQUAL(dispenser.newName(YulName{"x"}).str(), "x");
+	BOOST_CHECK_EQUAL(dispenser.newName(YulName{"x"}).str(), "x_1");
+}
+
+BOOST_AUTO_TEST_CASE(reserved_names_stay_used)
+{
+	NameDispenser dispenser{dialect(), std::set<YulName>{}, {YulName{"r"}, YulName{"r_1"}}};
+	BOOST_CHECK_EQUAL(dispenser.newName(YulName{"r"}).str(), "r_2");
+	dispenser.reset(Block{});
+	BOOST_CHECK_EQUAL(dispenser.newName(YulName{"r"}).str(), "r_2");
+	BOOST_CHECK_EQUAL(dispenser.newName(YulName{"r"}).str(), "r_3");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,154 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the binary encoding of Yul objects.
+ */
+
+#include <test/libyul/Common.h>
+
+#include <libyul/AsmAnalysisInfo.h>
+#include <libyul/Exceptions.h>
+#include <libyul/Object.h>
+#include <libyul/ObjectSerialiser.h>
+#include <libyul/YulStack.h>
+
+#include <liblangutil/DebugInfoSelection.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace solidity::langutil;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+std::string const source = R"(
+	/// @use-src 0:"a.sol", 1:"b.sol"
+	object "A" {
+		code {
+			/// @src 0:10:20
+			function f(a, b) -> r {
+				/// @src 1:3:4
+				switch a
+				case 0 { r := b }
+				case "abc" { leave }
+				default { r := 0x1234 }
+			}
+			let x := f(calldataload(0), true)
+			for { let i := 0 } lt(i, x) { i := add(i, 1) } {
+				if eq(i, 7) { break }
+				continue
+			}
+			datacopy(0, dataoffset("B"), datasize("B"))
+			sstore(0, mload(0))
+		}
+		object "B" {
+			code { mstore(0, 0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff) }
+			data "C" hex"0102"
+		}
+		data "D" "abc"
+	}
+)";
+
+std::shared_ptr<Object> parse()
+{
+	YulStack yulStack = parseYul(source, "source");
+	BOOST_REQUIRE(!yulStack.hasErrors());
+	return yulStack.parserResult();
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulObjectSerialiser)
+
+BOOST_AUTO_TEST_CASE(round_trip)
+{
+	std::shared_ptr<Object> object = parse();
+	std::string serialised = ObjectSerialiser::serialise(*object);
+
+	std::shared_ptr<Object> deserialised = ObjectSerialiser::deserialise(serialised, *object->dialect());
+	BOOST_REQUIRE(deserialised);
+	BOOST_CHECK(deserialised->analysisInfo);
+	BOOST_CHECK_EQUAL(deserialised->toString(), object->toString());
+	BOOST_CHECK_EQUAL(deserialised->toString(DebugInfoSelection::All()), object->toString(DebugInfoSelection::All()));
+	BOOST_CHECK(deserialised->subIndexByName == object->subIndexByName);
+	BOOST_CHECK_EQUAL(ObjectSerialiser::serialise(*deserialised), serialised);
+
+	auto const* subObject = dynamic_cast<Object const*>(deserialised->subObjects.at(0).get());
+	BOOST_REQUIRE(subObject);
+	BOOST_CHECK(subObject->analysisInfo);
+}
+
+BOOST_AUTO_TEST_CASE(without_debug_data)
+{
+	std::shared_ptr<Object> object = parse();
+	std::string withDebugData = ObjectSerialiser::serialise(*object);
+	std::string withoutDebugData = ObjectSerialiser::serialise(*object, false);
+	BOOST_CHECK_LT(withoutDebugData.size(), withDebugData.size());
+
+	std::shared_ptr<Object> deserialised = ObjectSerialiser::deserialise(withoutDebugData, *object->dialect());
+	BOOST_REQUIRE(deserialised);
+	BOOST_CHECK_EQUAL(
+		deserialised->toString(DebugInfoSelection::None()),
+		object->toString(DebugInfoSelection::None())
+	);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_input)
+{
+	std::shared_ptr<Object> object = parse();
+	std::string serialised = ObjectSerialiser::serialise(*object);
+	Dialect const& dialect = *object->dialect();
+
+	BOOST_CHECK_THROW(ObjectSerialiser::deserialise("", dialect), YulAssertion);
+	BOOST_CHECK_THROW(ObjectSerialiser::deserialise(object->toString(), dialect), YulAssertion);
+	BOOST_CHECK_THROW(ObjectSerialiser::deserialise(serialised.substr(0, serialised.size() - 1), dialect), YulAssertion);
+	BOOST_CHECK_THROW(ObjectSerialiser::deserialise(serialised + "x", dialect), YulAssertion);
+}
+
+BOOST_AUTO_TEST_CASE(corrupted_count)
+{
+	std::shared_ptr<Object> object = parse();
+	std::string serialised = ObjectSerialiser::serialise(*object);
+	Dialect const& dialect = *object->dialect();
+
+	// The size of the string table follows the magic and the format version.
+	size_t const countOffset = 5;
+	size_t countEnd = countOffset;
+	while (static_cast<uint8_t>(serialised.at(countEnd)) & 0x80)
+		++countEnd;
+	std::string const hugeCount = "\xff\xff\xff\xff\xff\xff\xff\xff\x7f";
+
+	// Has to be rejected before any memory is allocated for the entries.
+	BOOST_CHECK_THROW(
+		ObjectSerialiser::deserialise(serialised.substr(0, countOffset) + hugeCount + serialised.substr(countEnd + 1), dialect),
+		YulAssertion
+	);
+	BOOST_CHECK_THROW(ObjectSerialiser::deserialise(serialised.substr(0, countOffset) + hugeCount, dialect), YulAssertion);
+	// Counts that fit into the input, but exceed the number of entries.
+	BOOST_CHECK_THROW(
+		ObjectSerialiser::deserialise(serialised.substr(0, countOffset) + "\x7f" + serialised.substr(countEnd + 1), dialect),
+		YulAssertion
+	);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
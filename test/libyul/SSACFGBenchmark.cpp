@@ -0,0 +1,201 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Timing of the SSA CFG construction and of its liveness analysis on the optimized IR of
+ * the contracts in test/benchmarks and on the largest inputs of the Yul optimizer tests.
+ *
+ * Disabled by default, run it with:
+ * soltest --run_test=SSACFGBenchmark --log_level=message -- --testpath <path to test/>
+ */
+
+#include <test/libyul/Common.h>
+#include <test/Common.h>
+#include <test/TestCaseReader.h>
+
+#include <libyul/backends/evm/ControlFlow.h>
+#include <libyul/backends/evm/SSAControlFlowGraphBuilder.h>
+#include <libyul/Object.h>
+#include <libyul/YulStack.h>
+
+#include <libsolidity/interface/CompilerStack.h>
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <libsolutil/CommonIO.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+/// Number of timed runs per input. The fastest run is reported.
+size_t constexpr repetitions = 10;
+/// Number of Yul optimizer test inputs to measure, starting with the largest one.
+size_t constexpr optimizerTestInputs = 10;
+
+struct BenchmarkInput
+{
+	std::string name;
+	std::string source;
+};
+
+struct Timing
+{
+	std::chrono::nanoseconds build{0};
+	std::chrono::nanoseconds liveness{0};
+	size_t blocks = 0;
+};
+
+std::vector<BenchmarkInput> optimizedContracts()
+{
+	std::vector<BenchmarkInput> inputs;
+	boost::filesystem::path const directory = solidity::test::CommonOptions::get().testPath / "benchmarks";
+	for (std::string fileName: {"verifier.sol", "OptimizorClub.sol", "chains.sol"})
+	{
+		CompilerStack compiler;
+		compiler.setSources({{fileName, util::readFileAsString(directory / fileName)}});
+		compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+		compiler.setOptimiserSettings(OptimiserSettings::standard());
+		compiler.setViaIR(true);
+		BOOST_REQUIRE_MESSAGE(compiler.compile(), "Compiling " + fileName + " failed.");
+		for (std::string const& contractName: compiler.contractNames())
+			if (std::optional<std::string> const& ir = compiler.yulIROptimized(contractName); ir && !ir->empty())
+				inputs.push_back({contractName, *ir});
+	}
+	return inputs;
+}
+
+std::vector<BenchmarkInput> largestOptimizerTestInputs()
+{
+	std::vector<boost::filesystem::path> files;
+	for (auto const& entry: boost::filesystem::recursive_directory_iterator(
+		solidity::test::CommonOptions::get().testPath / "libyul" / "yulOptimizerTests"
+	))
+		if (entry.path().extension() == ".yul")
+			files.push_back(entry.path());
+	std::sort(files.begin(), files.end(), [](auto const& _lhs, auto const& _rhs) {
+		return boost::filesystem::file_size(_lhs) > boost::filesystem::file_size(_rhs);
+	});
+
+	std::vector<BenchmarkInput> inputs;
+	for (auto const& file: files)
+	{
+		if (inputs.size() == optimizerTestInputs)
+			break;
+		solidity::frontend::test::TestCaseReader reader(file.string());
+		if (reader.stringSetting("dialect", "evm") != "evm")
+			continue;
+		YulStack yulStack = parseYul(reader.source(), file.filename().string(), OptimiserSettings::full());
+		if (yulStack.hasErrors())
+			continue;
+		yulStack.optimize();
+		inputs.push_back({
+			file.parent_path().filename().string() + "/" + file.filename().string(),
+			yulStack.print()
+		});
+	}
+	return inputs;
+}
+
+void measure(YulStack const& _yulStack, Object const& _object, Timing& _timing)
+{
+	if (_object.hasCode())
+	{
+		Timing fastest{std::chrono::nanoseconds::max(), std::chrono::nanoseconds::max(), 0};
+		for (size_t run = 0; run < repetitions; ++run)
+		{
+			auto const start = std::chrono::steady_clock::now();
+			std::unique_ptr<ControlFlow> controlFlow = SSAControlFlowGraphBuilder::build(
+				*_object.analysisInfo,
+				_yulStack.dialect(),
+				_object.code()->root()
+			);
+			auto const built = std::chrono::steady_clock::now();
+			ControlFlowLiveness liveness(*controlFlow);
+			auto const analyzed = std::chrono::steady_clock::now();
+
+			fastest.build = std::min(fastest.build, std::chrono::duration_cast<std::chrono::nanoseconds>(built - start));
+			fastest.liveness = std::min(fastest.liveness, std::chrono::duration_cast<std::chrono::nanoseconds>(analyzed - built));
+			fastest.blocks = controlFlow->mainGraph->numBlocks();
+			for (auto const& functionGraph: controlFlow->functionGraphs)
+				fastest.blocks += functionGraph->numBlocks();
+		}
+		_timing.build += fastest.build;
+		_timing.liveness += fastest.liveness;
+		_timing.blocks += fastest.blocks;
+	}
+
+	for (std::shared_ptr<ObjectNode> const& subObjectNode: _object.subObjects)
+		if (auto const* subObject = dynamic_cast<Object const*>(subObjectNode.get()))
+			measure(_yulStack, *subObject, _timing);
+}
+
+std::string milliseconds(std::chrono::nanoseconds _duration)
+{
+	return std::to_string(static_cast<double>(_duration.count()) / 1e6) + " ms";
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(SSACFGBenchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(build_and_liveness)
+{
+	std::vector<BenchmarkInput> inputs = optimizedContracts();
+	for (BenchmarkInput& input: largestOptimizerTestInputs())
+		inputs.push_back(std::move(input));
+
+	Timing total;
+	for (BenchmarkInput const& input: inputs)
+	{
+		YulStack yulStack = parseYul(input.source, input.name, OptimiserSettings::none());
+		BOOST_REQUIRE_MESSAGE(!yulStack.hasErrors(), "Parsing " + input.name + " failed.");
+
+		Timing timing;
+		measure(yulStack, *yulStack.parserResult(), timing);
+		BOOST_TEST_MESSAGE(
+			input.name + ": " +
+			std::to_string(timing.blocks) + " blocks, " +
+			"build " + milliseconds(timing.build) + ", " +
+			"liveness " + milliseconds(timing.liveness)
+		);
+		total.build += timing.build;
+		total.liveness += timing.liveness;
+		total.blocks += timing.blocks;
+	}
+	BOOST_TEST_MESSAGE(
+		"Total: " +
+		std::to_string(total.blocks) + " blocks, " +
+		"build " + milliseconds(total.build) + ", " +
+		"liveness " + milliseconds(total.liveness)
+	);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
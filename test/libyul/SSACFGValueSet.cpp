@@ -0,0 +1,182 @@
+/*
+    This file is part of solidity.
+
+    solidity is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    solidity is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the sparse bitset of SSA value ids, checked against std::set.
+ */
+
+#include <libyul/backends/evm/SSACFGValueSet.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <set>
+#include <vector>
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+using ValueId = SSACFG::ValueId;
+
+std::vector<size_t> values(SSACFGValueSet const& _set)
+{
+	std::vector<size_t> result;
+	for (ValueId value: _set)
+		result.push_back(value.value);
+	return result;
+}
+
+std::vector<size_t> values(std::set<ValueId> const& _set)
+{
+	std::vector<size_t> result;
+	for (ValueId value: _set)
+		result.push_back(value.value);
+	return result;
+}
+
+void checkEqual(SSACFGValueSet const& _set, std::set<ValueId> const& _reference)
+{
+	std::vector<size_t> actual = values(_set);
+	std::vector<size_t> expected = values(_reference);
+	BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+	BOOST_CHECK_EQUAL(_set.size(), _reference.size());
+	BOOST_CHECK_EQUAL(_set.empty(), _reference.empty());
+	BOOST_CHECK(_set == SSACFGValueSet(_reference));
+}
+
+/// Random values, clustered so that words hold several values, but also spread over many words.
+std::set<ValueId> randomValues(std::mt19937& _rng, size_t _count)
+{
+	std::uniform_int_distribution<size_t> word(0, 20);
+	std::uniform_int_distribution<size_t> bit(0, 63);
+	std::set<ValueId> result;
+	for (size_t i = 0; i < _count; ++i)
+		result.insert(ValueId{word(_rng) * 64 + bit(_rng)});
+	return result;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulSSACFGValueSet)
+
+BOOST_AUTO_TEST_CASE(empty)
+{
+	SSACFGValueSet set;
+	BOOST_CHECK(set.empty());
+	BOOST_CHECK_EQUAL(set.size(), 0);
+	BOOST_CHECK(set.begin() == set.end());
+	BOOST_CHECK(!set.contains(ValueId{0}));
+	BOOST_CHECK(set == SSACFGValueSet{});
+	set.erase(ValueId{5});
+	BOOST_CHECK(set.empty());
+}
+
+BOOST_AUTO_TEST_CASE(insert_and_erase)
+{
+	std::set<ValueId> reference;
+	SSACFGValueSet set;
+	// Word boundaries, the highest bit of a word and values far apart.
+	for (size_t value: {64u, 0u, 63u, 1u, 127u, 128u, 1000000u, 64u, 0u})
+	{
+		set.insert(ValueId{value});
+		reference.insert(ValueId{value});
+		checkEqual(set, reference);
+	}
+	for (size_t value: {0u, 0u, 2u, 63u, 1000000u, 64u, 1u, 127u, 128u})
+	{
+		set.erase(ValueId{value});
+		reference.erase(ValueId{value});
+		checkEqual(set, reference);
+		BOOST_CHECK(!set.contains(ValueId{value}));
+	}
+	BOOST_CHECK(set.empty());
+}
+
+BOOST_AUTO_TEST_CASE(iteration_order)
+{
+	SSACFGValueSet set;
+	for (size_t value: {200u, 3u, 64u, 65u, 2u, 130u, 63u})
+		set.insert(ValueId{value});
+	std::vector<size_t> expected{2, 3, 63, 64, 65, 130, 200};
+	std::vector<size_t> actual = values(set);
+	BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+
+	auto it = set.begin();
+	BOOST_CHECK_EQUAL((*it++).value, 2);
+	BOOST_CHECK_EQUAL((*it).value, 3);
+}
+
+BOOST_AUTO_TEST_CASE(equality)
+{
+	SSACFGValueSet lhs(std::set<ValueId>{ValueId{1}, ValueId{70}});
+	SSACFGValueSet rhs;
+	rhs.insert(ValueId{70});
+	BOOST_CHECK(!(lhs == rhs));
+	rhs.insert(ValueId{1});
+	BOOST_CHECK(lhs == rhs);
+	// Erasing the last value of a word must not leave an empty word behind.
+	rhs.insert(ValueId{300});
+	rhs.erase(ValueId{300});
+	BOOST_CHECK(lhs == rhs);
+	rhs.erase(ValueId{70});
+	lhs -= SSACFGValueSet(std::set<ValueId>{ValueId{70}});
+	BOOST_CHECK(lhs == rhs);
+}
+
+BOOST_AUTO_TEST_CASE(randomised_against_std_set)
+{
+	std::mt19937 rng(1234);
+	for (size_t round = 0; round < 200; ++round)
+	{
+		std::set<ValueId> lhsReference = randomValues(rng, round % 50);
+		std::set<ValueId> rhsReference = randomValues(rng, (round * 7) % 60);
+		SSACFGValueSet lhs(lhsReference);
+		SSACFGValueSet rhs(rhsReference);
+		checkEqual(lhs, lhsReference);
+		checkEqual(rhs, rhsReference);
+
+		std::set<ValueId> unionReference = lhsReference;
+		unionReference.insert(rhsReference.begin(), rhsReference.end());
+		checkEqual(lhs + rhs, unionReference);
+		checkEqual(rhs + lhs, unionReference);
+
+		std::set<ValueId> differenceReference;
+		for (ValueId value: lhsReference)
+			if (!rhsReference.count(value))
+				differenceReference.insert(value);
+		checkEqual(lhs - rhs, differenceReference);
+
+		SSACFGValueSet inPlace = lhs;
+		inPlace += rhs;
+		inPlace -= lhs;
+		std::set<ValueId> inPlaceReference;
+		for (ValueId value: rhsReference)
+			if (!lhsReference.count(value))
+				inPlaceReference.insert(value);
+		checkEqual(inPlace, inPlaceReference);
+
+		for (size_t value = 0; value < 21 * 64; value += 13)
+			BOOST_CHECK_EQUAL(lhs.contains(ValueId{value}), lhsReference.count(ValueId{value}) > 0);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -69,6 +69,12 @@ void IsolTestOptions::addOptions()
 		("help", po::bool_switch(&showHelp)->default_value(showHelp), "Show this help screen.")
 		("no-color", po::bool_switch(&noColor)->default_value(noColor), "Don't use colors.")
 		("accept-updates", po::bool_switch(&acceptUpdates)->default_value(acceptUpdates), "Automatically accept expectation updates.")
+		(
+			"jobs,j",
+			po::value<size_t>(&jobs)->default_value(jobs),
+			"Run test cases in the given number of worker processes. "
+			"Failing tests are reported without prompting for edits or updates."
+		)
 		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.");
 }
 
@@ -97,6 +103,18 @@ void IsolTestOptions::validate() const
 		ConfigException,
 		"Invalid test unit filter - can only contain '" + filterString + ": " + testFilter
 	);
+	assertThrow(
+		jobs > 0,
+		ConfigException,
+		"Number of jobs needs to be at least 1."
+	);
+#if defined(_WIN32)
+	assertThrow(
+		jobs == 1,
+		ConfigException,
+		"Running tests in multiple jobs is not supported on Windows."
+	);
+#endif
 }
 
 }
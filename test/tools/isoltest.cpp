@@ -16,8 +16,10 @@
 */
 // SPDX-License-Identifier: GPL-3.0
 
+#include <libsolutil/Common.h>
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/AnsiColorized.h>
+#include <libsolutil/TemporaryDirectory.h>
 
 #include <memory>
 #include <test/Common.h>
@@ -28,14 +30,21 @@
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/filesystem.hpp>
 
+#include <cerrno>
+#include <charconv>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <optional>
 #include <queue>
 #include <regex>
 #include <utility>
 
 #if defined(_WIN32)
 #include <windows.h>
+#else
+#include <sys/wait.h>
+#include <unistd.h>
 #endif
 
 using namespace solidity;
@@ -132,6 +141,29 @@ private:
 	void updateTestCase();
 	Request handleResponse(bool _exception);
 
+#if !defined(_WIN32)
+	/// Non-interactive variant of processPath() that distributes the test cases over
+	/// `_options.jobs` forked worker processes. Each worker writes the output of every test case
+	/// into a separate file, which is printed in the order of the serial run once all workers finish.
+	static TestStats processPathInParallel(
+		TestCreator _testCaseCreator,
+		TestOptions const& _options,
+		fs::path const& _basepath,
+		fs::path const& _path,
+		solidity::test::Batcher& _batcher
+	);
+	/// Runs the test cases at the given positions of @a _testPaths, storing their output and results
+	/// in @a _outputDirectory. Executed inside a worker process.
+	static void runWorker(
+		TestCreator _testCaseCreator,
+		TestOptions const& _options,
+		fs::path const& _basepath,
+		std::vector<fs::path> const& _testPaths,
+		size_t _worker,
+		fs::path const& _outputDirectory
+	);
+#endif
+
 	TestCreator m_testCaseCreator;
 	TestOptions const& m_options;
 	TestFilter m_filter;
@@ -260,6 +292,11 @@ TestStats TestTool::processPath(
 	solidity::test::Batcher& _batcher
 )
 {
+#if !defined(_WIN32)
+	if (_options.jobs > 1)
+		return processPathInParallel(_testCaseCreator, _options, _basepath, _path, _batcher);
+#endif
+
 	std::queue<fs::path> paths;
 	paths.push(_path);
 	int successCount = 0;
@@ -338,6 +375,186 @@ TestStats TestTool::processPath(
 
 }
 
+#if !defined(_WIN32)
+TestStats TestTool::processPathInParallel(
+	TestCreator _testCaseCreator,
+	TestOptions const& _options,
+	fs::path const& _basepath,
+	fs::path const& _path,
+	solidity::test::Batcher& _batcher
+)
+{
+	TestFilter const filter{_options.testFilter};
+	std::vector<fs::path> testPaths;
+	std::queue<fs::path> paths;
+	paths.push(_path);
+	int successCount = 0;
+	int testCount = 0;
+	int skippedCount = 0;
+
+	// Collect the test cases in the same order in which processPath() would run them.
+	// Test cases excluded by the filter are skipped here, so that they do not take up slots of the workers.
+	while (!paths.empty())
+	{
+		fs::path currentPath = paths.front();
+		paths.pop();
+
+		fs::path fullpath = _basepath / currentPath;
+		if (fs::is_directory(fullpath))
+		{
+			for (auto const& entry: boost::iterator_range<fs::directory_iterator>(
+				fs::directory_iterator(fullpath),
+				fs::directory_iterator()
+			))
+				if (fs::is_directory(entry.path()) || TestCase::isTestFilename(entry.path().filename()))
+					paths.push(currentPath / entry.path().filename());
+		}
+		else if (!_batcher.checkAndAdvance())
+			++skippedCount;
+		else if (!filter.matches(fullpath, currentPath.generic_path().string()))
+		{
+			++testCount;
+			++skippedCount;
+		}
+		else
+			testPaths.push_back(currentPath);
+	}
+
+	TemporaryDirectory outputDirectory("isoltest");
+
+	// Anything still buffered would otherwise be printed once more by every worker.
+	std::cout.flush();
+
+	std::vector<pid_t> workers;
+	for (size_t worker = 0; worker < std::min(_options.jobs, testPaths.size()); ++worker)
+	{
+		pid_t pid = fork();
+		if (pid < 0)
+			throw std::runtime_error("Failed to start a test worker process.");
+		if (pid == 0)
+		{
+			int exitCode = EXIT_SUCCESS;
+			try
+			{
+				runWorker(_testCaseCreator, _options, _basepath, testPaths, worker, outputDirectory.path());
+			}
+			catch (...)
+			{
+				exitCode = EXIT_FAILURE;
+			}
+			std::cout.flush();
+			_exit(exitCode);
+		}
+		workers.push_back(pid);
+	}
+	for (pid_t pid: workers)
+	{
+		// Retry if a signal interrupts the wait before the worker finished.
+		pid_t result;
+		do
+			result = waitpid(pid, nullptr, 0);
+		while (result < 0 && errno == EINTR);
+	}
+
+	bool formatted{!_options.noColor};
+	for (size_t i = 0; i < testPaths.size(); ++i)
+	{
+		++testCount;
+		fs::path outputFile = outputDirectory.path() / (std::to_string(i) + ".out");
+		fs::path resultFile = outputDirectory.path() / (std::to_string(i) + ".result");
+		std::optional<Result> result;
+		if (fs::exists(resultFile))
+		{
+			std::string const resultText = readFileAsString(resultFile);
+			int resultValue = 0;
+			auto const [end, error] = std::from_chars(resultText.data(), resultText.data() + resultText.size(), resultValue);
+			if (
+				error == std::errc{} &&
+				end == resultText.data() + resultText.size() &&
+				resultValue >= static_cast<int>(Result::Success) &&
+				resultValue <= static_cast<int>(Result::Skipped)
+			)
+				result = static_cast<Result>(resultValue);
+		}
+		if (!result)
+		{
+			// The worker process died while running this test case.
+			AnsiColorized(std::cout, formatted, {BOLD}) << testPaths[i].generic_path().string() << ": ";
+			AnsiColorized(std::cout, formatted, {BOLD, RED}) << "FAIL (worker process terminated)" << std::endl;
+			if (fs::exists(outputFile))
+				std::cout << readFileAsString(outputFile) << std::endl;
+			continue;
+		}
+
+		std::cout << readFileAsString(outputFile);
+		switch (*result)
+		{
+		case Result::Success:
+			++successCount;
+			break;
+		case Result::Skipped:
+			++skippedCount;
+			break;
+		case Result::Failure:
+		case Result::Exception:
+			break;
+		}
+	}
+
+	return { successCount, testCount, skippedCount };
+}
+
+void TestTool::runWorker(
+	TestCreator _testCaseCreator,
+	TestOptions const& _options,
+	fs::path const& _basepath,
+	std::vector<fs::path> const& _testPaths,
+	size_t _worker,
+	fs::path const& _outputDirectory
+)
+{
+	std::streambuf* standardOutput = std::cout.rdbuf();
+	ScopeGuard restoreStandardOutput([&]() { std::cout.rdbuf(standardOutput); });
+
+	for (size_t i = _worker; i < _testPaths.size(); i += _options.jobs)
+	{
+		std::ofstream output((_outputDirectory / (std::to_string(i) + ".out")).string());
+		std::cout.rdbuf(output.rdbuf());
+
+		Result result = Result::Skipped;
+		while (true)
+		{
+			TestTool testTool(
+				_testCaseCreator,
+				_options,
+				_basepath / _testPaths[i],
+				_testPaths[i].generic_path().string()
+			);
+			result = testTool.process();
+			if (result != Result::Failure || !_options.acceptUpdates)
+				break;
+
+			testTool.updateTestCase();
+			std::cout << "Re-running test case..." << std::endl;
+		}
+
+		std::cout.flush();
+		std::cout.rdbuf(standardOutput);
+		// The result file is written last so that its presence marks the test case as completed.
+		// It is renamed into place, so that a worker dying while writing it cannot leave a partial result behind.
+		fs::path const resultFile = _outputDirectory / (std::to_string(i) + ".result");
+		fs::path const temporaryResultFile = _outputDirectory / (std::to_string(i) + ".result.tmp");
+		{
+			std::ofstream resultOutput(temporaryResultFile.string());
+			resultOutput << static_cast<int>(result);
+			if (!resultOutput.flush())
+				throw std::runtime_error("Failed to write the test result to " + temporaryResultFile.string() + ".");
+		}
+		fs::rename(temporaryResultFile, resultFile);
+	}
+}
+#endif
+
 namespace
 {
 
@@ -0,0 +1,69 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/Exceptions.h>
+#include <libyul/Object.h>
+#include <libyul/ObjectSerialiser.h>
+#include <libyul/YulStack.h>
+
+#include <liblangutil/DebugInfoSelection.h>
+#include <liblangutil/EVMVersion.h>
+
+using namespace solidity;
+using namespace solidity::langutil;
+using namespace solidity::yul;
+
+// Prototype as we can't use the FuzzerInterface.h header.
+extern "C" int LLVMFuzzerTestOneInput(uint8_t const* _data, size_t _size);
+
+extern "C" int LLVMFuzzerTestOneInput(uint8_t const* _data, size_t _size)
+{
+	if (_size > 600)
+		return 0;
+
+	YulStringRepository::reset();
+
+	std::string input(reinterpret_cast<char const*>(_data), _size);
+	YulStack stack(
+		langutil::EVMVersion(),
+		std::nullopt,
+		YulStack::Language::StrictAssembly,
+		solidity::frontend::OptimiserSettings::minimal(),
+		DebugInfoSelection::All()
+	);
+
+	if (!stack.parseAndAnalyze("source", input))
+		return 0;
+
+	std::shared_ptr<Object> object = stack.parserResult();
+	std::string serialised = ObjectSerialiser::serialise(*object);
+	std::shared_ptr<Object> deserialised = ObjectSerialiser::deserialise(serialised, *object->dialect());
+	yulAssert(deserialised->toString(DebugInfoSelection::All()) == object->toString(DebugInfoSelection::All()), "");
+	yulAssert(ObjectSerialiser::serialise(*deserialised) == serialised, "");
+
+	// Reading the corrupted encoding has to fail with an assertion, not by crashing.
+	serialised[_size % serialised.size()] ^= static_cast<char>(_data[0] | 1);
+	try
+	{
+		ObjectSerialiser::deserialise(serialised, *object->dialect());
+	}
+	catch (YulAssertion const&)
+	{
+	}
+	return 0;
+}